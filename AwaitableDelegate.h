@@ -0,0 +1,194 @@
+#pragma once
+
+#include "Delegate.h"
+
+#if !defined(__cpp_impl_coroutine) || !__has_include(<coroutine>)
+#error "AwaitableDelegate.h requires C++20 coroutines."
+#endif
+
+#include <coroutine>
+
+namespace dw
+{
+    /**
+     * @brief  Delegate a coroutine can *co_await*: it is resumed with the arguments of the next operator() call.
+     * @note   Waiters are linked through their awaiters, which live in the suspended coroutine frames, so awaiting
+     *         and resuming allocate nothing. Waiters are resumed in awaiting order, after the subscribed functions,
+     *         on the thread calling operator(); awaiting again from a resumed coroutine waits for the next call.
+     *         Reference arguments stay valid until the resumed coroutine suspends again.
+     *         Destroying a suspended coroutine removes its waiter; destroying the delegate leaves its waiters suspended.
+     *         Like Delegate, it is not thread-safe.
+     * @tparam Allocator    Allocator of the subscribers and saved parameters.
+     * @tparam Params       Any number of arguments of any type.
+     */
+    template <typename Allocator, typename... Params>
+    class BasicAwaitableDelegate : public BasicDelegate<Allocator, Params...>
+    {
+    public:
+        using Parent = BasicDelegate<Allocator, Params...>;
+        using Parent::operator();
+        using Parent::subscribers;
+
+        /**
+         * @brief           Value of a *co_await* expression: void, the argument or a tuple of the arguments.
+         */
+        using ResultType = typename std::conditional<sizeof...(Params) == 0, void,
+                                                     typename std::conditional<sizeof...(Params) == 1, typename std::tuple_element<0, std::tuple<Params..., void>>::type,
+                                                                               std::tuple<Params...>>::type>::type;
+
+    private:
+        using Arguments = std::tuple<ArgumentType<Params>...>;
+
+        class Awaiter;
+
+        struct WaitList
+        {
+            Awaiter *head = nullptr;
+            Awaiter *tail = nullptr;
+
+            void PushBack(Awaiter &awaiter)
+            {
+                awaiter.list = this;
+                awaiter.prev = tail;
+                awaiter.next = nullptr;
+                (tail ? tail->next : head) = &awaiter;
+                tail = &awaiter;
+            }
+
+            void Remove(Awaiter &awaiter)
+            {
+                (awaiter.prev ? awaiter.prev->next : head) = awaiter.next;
+                (awaiter.next ? awaiter.next->prev : tail) = awaiter.prev;
+                awaiter.list = nullptr;
+            }
+        };
+
+        /**
+         * @brief           Awaiter of one *co_await*, linked into the waiting list while suspended.
+         */
+        class Awaiter
+        {
+        public:
+            explicit Awaiter(BasicAwaitableDelegate &owner) : owner(owner) {}
+
+            Awaiter(const Awaiter &) = delete;
+            Awaiter &operator=(const Awaiter &) = delete;
+
+            ~Awaiter()
+            {
+                if (list)
+                {
+                    list->Remove(*this);
+                }
+            }
+
+            bool await_ready() const noexcept { return false; }
+
+            void await_suspend(std::coroutine_handle<> handle) noexcept
+            {
+                coroutine = handle;
+                owner.waiting.PushBack(*this);
+            }
+
+            ResultType await_resume() const
+            {
+                return Result(std::index_sequence_for<Params...>());
+            }
+
+        private:
+            friend struct WaitList;
+            friend class BasicAwaitableDelegate;
+
+            template <size_t... Indices>
+            ResultType Result(std::index_sequence<Indices...>) const
+            {
+                return ResultType(static_cast<Params>(std::get<Indices>(*arguments))...);
+            }
+
+            BasicAwaitableDelegate &owner;
+            WaitList *list = nullptr;
+            Awaiter *prev = nullptr;
+            Awaiter *next = nullptr;
+            std::coroutine_handle<> coroutine;
+            const Arguments *arguments = nullptr;
+        };
+
+    public:
+        BasicAwaitableDelegate() = default;
+        explicit BasicAwaitableDelegate(const Allocator &allocator) : Parent(allocator) {}
+        BasicAwaitableDelegate(const BasicAwaitableDelegate &) = delete;
+        BasicAwaitableDelegate &operator=(const BasicAwaitableDelegate &) = delete;
+
+        ~BasicAwaitableDelegate()
+        {
+            while (waiting.head)
+            {
+                waiting.Remove(*waiting.head);
+            }
+        }
+
+        /**
+         * @brief           Invoke all subscribed functions, then resume the coroutines awaiting this delegate.
+         *
+         * @param  params:  Arguments of each subscribed function, and result of each *co_await*.
+         */
+        void operator()(ArgumentType<Params>... params)
+        {
+            for (auto &&i : subscribers)
+            {
+                if (i)
+                {
+                    i.CallShared(params...);
+                }
+            }
+
+            if (!waiting.head)
+            {
+                return;
+            }
+
+            // Resume from a list of our own: coroutines awaiting again (or nested calls) only see the waiting list.
+            WaitList resuming = waiting;
+            waiting = WaitList();
+            for (Awaiter *i = resuming.head; i; i = i->next)
+            {
+                i->list = &resuming;
+            }
+
+            Arguments arguments(params...);
+            while (Awaiter *awaiter = resuming.head)
+            {
+                resuming.Remove(*awaiter);
+                awaiter->arguments = &arguments;
+                awaiter->coroutine.resume();
+            }
+        }
+
+        /**
+         * @returns         Awaiter suspending the coroutine until the next operator() call.
+         */
+        Awaiter operator co_await() { return Awaiter(*this); }
+
+        /**
+         * @returns         true if a coroutine is awaiting this delegate.
+         */
+        bool IsAwaited() const { return waiting.head != nullptr; }
+
+    private:
+        WaitList waiting;
+    };
+
+    /**
+     * @brief  BasicAwaitableDelegate using the default allocator.
+     */
+    template <typename... Params>
+    using AwaitableDelegate = BasicAwaitableDelegate<DefaultAllocator, Params...>;
+
+#if DW_HAS_PMR
+    namespace pmr
+    {
+        template <typename... Params>
+        using AwaitableDelegate = BasicAwaitableDelegate<Allocator, Params...>;
+    } // namespace pmr
+#endif
+} // namespace dw
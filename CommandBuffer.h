@@ -0,0 +1,337 @@
+#pragma once
+
+#include "Delegate.h"
+
+namespace dw
+{
+    /**
+     * @brief  Arguments of a recorded command, as a plain aggregate: unlike std::tuple, it is trivially copyable when
+     *         every argument is, so such commands need no cleanup.
+     */
+    template <typename... Args>
+    struct CommandArguments
+    {
+        static CommandArguments Make() { return CommandArguments(); }
+    };
+
+    template <typename Last>
+    struct CommandArguments<Last>
+    {
+        Last first;
+
+        template <typename Value>
+        static CommandArguments Make(Value &&value)
+        {
+            return CommandArguments{Last(std::forward<Value>(value))};
+        }
+    };
+
+    template <typename First, typename Second, typename... Rest>
+    struct CommandArguments<First, Second, Rest...>
+    {
+        First first;
+        CommandArguments<Second, Rest...> rest;
+
+        template <typename Value, typename... Values>
+        static CommandArguments Make(Value &&value, Values &&...values)
+        {
+            return CommandArguments{First(std::forward<Value>(value)), CommandArguments<Second, Rest...>::Make(std::forward<Values>(values)...)};
+        }
+    };
+
+    /**
+     * @brief  Ordered list of calls to delegates of any signature, recorded into one contiguous byte stream.
+     * @note   Each command is a small header (execute function, manager, sizes) followed by the target and its
+     *         arguments, packed at their natural alignment. Replay() walks the stream once, in recording order.
+     *         Reset() rewinds it without freeing: once the buffer has grown to the largest list, recording doesn't
+     *         allocate. Commands whose target and arguments are trivially copyable and destructible need no cleanup,
+     *         so resetting a buffer holding only those is O(1). Arguments are stored by value (decayed); wrap one in
+     *         std::ref() to record a reference. Recorded delegates are referenced and must outlive the replay.
+     *         Not thread-safe, and commands must not record into the buffer being replayed.
+     * @tparam Allocator    Allocator of the byte stream.
+     */
+    template <typename Allocator>
+    class BasicCommandBuffer
+    {
+        enum class Operation
+        {
+            Relocate,
+            Destroy
+        };
+
+        typedef void (*ExecuteType)(void *);
+        typedef void (*ManagerType)(Operation, void *, void *);
+
+        struct Header
+        {
+            ExecuteType execute;
+            ManagerType manager;
+            uint32_t payload;
+            uint32_t size;
+        };
+
+        using Block = typename std::aligned_storage<alignof(std::max_align_t), alignof(std::max_align_t)>::type;
+
+        template <typename Target, typename... Args>
+        struct Command
+        {
+            Target target;
+            CommandArguments<Args...> arguments;
+        };
+
+        /**
+         * @brief           Target calling a delegate kept by reference.
+         */
+        template <typename DelegateType>
+        struct DelegateReference
+        {
+            DelegateType *delegate;
+
+            template <typename... Args>
+            void operator()(Args &&...args) const
+            {
+                (*delegate)(std::forward<Args>(args)...);
+            }
+        };
+
+    public:
+        using AllocatorType = Allocator;
+
+        BasicCommandBuffer() : BasicCommandBuffer(Allocator()) {}
+        explicit BasicCommandBuffer(const Allocator &allocator) : storage(allocator) {}
+
+        BasicCommandBuffer(const BasicCommandBuffer &) = delete;
+        BasicCommandBuffer &operator=(const BasicCommandBuffer &) = delete;
+
+        BasicCommandBuffer(BasicCommandBuffer &&other) noexcept
+            : storage(std::move(other.storage)), used(other.used), count(other.count), managed(other.managed)
+        {
+            other.used = other.count = other.managed = 0;
+        }
+
+        ~BasicCommandBuffer() { Reset(); }
+
+        /**
+         * @returns         Allocator of the byte stream.
+         */
+        Allocator GetAllocator() const { return Allocator(storage.get_allocator()); }
+
+        /**
+         * @brief           Record a call of *delegate* with *args*, e.g. a Delegate, RetDelegate or MemberDelegate
+         *                  (whose first argument is the object).
+         * @note            The delegate is kept by reference. Results are discarded.
+         */
+        template <typename DelegateType, typename... Args>
+        void Record(DelegateType &delegate, Args &&...args)
+        {
+            Emplace(DelegateReference<DelegateType>{&delegate}, std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief           Record a call of a copy of *function* with *args*.
+         * @param  function:    Function pointer, lambda or functor invocable with the recorded arguments as lvalues.
+         */
+        template <typename F, typename... Args>
+        void RecordFunction(F &&function, Args &&...args)
+        {
+            Emplace(std::forward<F>(function), std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief           Call every recorded command in recording order, passing the arguments as lvalues.
+         *                  The commands are kept: the list can be replayed again until Reset().
+         * @returns         Count of replayed commands.
+         */
+        size_t Replay()
+        {
+            unsigned char *bytes = Bytes();
+            for (size_t offset = 0; offset < used;)
+            {
+                Header *header = reinterpret_cast<Header *>(bytes + offset);
+                header->execute(bytes + offset + header->payload);
+                offset += header->size;
+            }
+            return count;
+        }
+
+        /**
+         * @brief           Destroy every command and rewind the stream, keeping its capacity.
+         */
+        void Reset()
+        {
+            if (managed)
+            {
+                unsigned char *bytes = Bytes();
+                for (size_t offset = 0; offset < used;)
+                {
+                    Header *header = reinterpret_cast<Header *>(bytes + offset);
+                    if (header->manager)
+                    {
+                        header->manager(Operation::Destroy, bytes + offset + header->payload, nullptr);
+                    }
+                    offset += header->size;
+                }
+            }
+            used = count = managed = 0;
+        }
+
+        /**
+         * @brief           Grow the stream to at least *bytes* bytes.
+         */
+        void Reserve(size_t bytes)
+        {
+            if (bytes > Capacity())
+            {
+                Grow(bytes);
+            }
+        }
+
+        /**
+         * @returns         Count of recorded commands.
+         */
+        size_t Count() const { return count; }
+
+        /**
+         * @returns         true if no command is recorded.
+         */
+        bool IsEmpty() const { return count == 0; }
+
+        /**
+         * @returns         Count of bytes used by the recorded commands.
+         */
+        size_t Size() const { return used; }
+
+        /**
+         * @returns         Count of bytes the stream can hold without growing.
+         */
+        size_t Capacity() const { return storage.size() * sizeof(Block); }
+
+    private:
+        static constexpr size_t Align(size_t offset, size_t alignment)
+        {
+            return (offset + alignment - 1) / alignment * alignment;
+        }
+
+        template <typename F, typename... Args>
+        void Emplace(F &&function, Args &&...args)
+        {
+            using Payload = Command<typename std::decay<F>::type, typename std::decay<Args>::type...>;
+
+            static_assert(alignof(Payload) <= alignof(Block), "Command is over-aligned!");
+
+            // The stream is aligned to Block and each command starts at a multiple of alignof(Header), so the payload
+            // is aligned from its absolute offset in the stream, not from the start of its command.
+            const size_t payload = Align(used + sizeof(Header), alignof(Payload)) - used;
+            const size_t size = Align(payload + sizeof(Payload), alignof(Header));
+            constexpr bool trivial = std::is_trivially_copyable<Payload>::value && std::is_trivially_destructible<Payload>::value;
+
+            if (used + size > Capacity())
+            {
+                Grow(std::max(used + size, 2 * Capacity()));
+            }
+
+            unsigned char *command = Bytes() + used;
+            ::new (static_cast<void *>(command + payload)) Payload{typename std::decay<F>::type(std::forward<F>(function)),
+                                                                   CommandArguments<typename std::decay<Args>::type...>::Make(std::forward<Args>(args)...)};
+            ::new (static_cast<void *>(command)) Header{&Execute<Payload>, trivial ? nullptr : &Manage<Payload>,
+                                                        static_cast<uint32_t>(payload), static_cast<uint32_t>(size)};
+            used += size;
+            count++;
+            managed += !trivial;
+        }
+
+        template <typename Payload>
+        static void Execute(void *payload)
+        {
+            Payload &command = *static_cast<Payload *>(payload);
+            Call(command.target, command.arguments);
+        }
+
+        /**
+         * @brief           Call *function* with the arguments *done* already unpacked, followed by *arguments*.
+         */
+        template <typename F, typename... Done>
+        static void Call(F &function, CommandArguments<> &, Done &...done)
+        {
+            function(done...);
+        }
+
+        template <typename F, typename Last, typename... Done>
+        static void Call(F &function, CommandArguments<Last> &arguments, Done &...done)
+        {
+            function(done..., arguments.first);
+        }
+
+        template <typename F, typename First, typename Second, typename... Rest, typename... Done>
+        static void Call(F &function, CommandArguments<First, Second, Rest...> &arguments, Done &...done)
+        {
+            Call(function, arguments.rest, done..., arguments.first);
+        }
+
+        template <typename Payload>
+        static void Manage(Operation operation, void *from, void *to)
+        {
+            Payload *command = static_cast<Payload *>(from);
+            if (operation == Operation::Relocate)
+            {
+                ::new (to) Payload(std::move(*command));
+            }
+            command->~Payload();
+        }
+
+        /**
+         * @brief           Move the commands into a new stream of at least *bytes* bytes.
+         */
+        void Grow(size_t bytes)
+        {
+            AllocatorVector<Block, Allocator> next((bytes + sizeof(Block) - 1) / sizeof(Block), storage.get_allocator());
+            unsigned char *from = Bytes();
+            unsigned char *to = reinterpret_cast<unsigned char *>(next.data());
+
+            if (!managed)
+            {
+                if (used)
+                {
+                    std::memcpy(to, from, used);
+                }
+            }
+            else
+            {
+                for (size_t offset = 0; offset < used;)
+                {
+                    Header *header = reinterpret_cast<Header *>(from + offset);
+                    ::new (static_cast<void *>(to + offset)) Header(*header);
+                    if (header->manager)
+                    {
+                        header->manager(Operation::Relocate, from + offset + header->payload, to + offset + header->payload);
+                    }
+                    else
+                    {
+                        std::memcpy(to + offset + header->payload, from + offset + header->payload, header->size - header->payload);
+                    }
+                    offset += header->size;
+                }
+            }
+            storage.swap(next);
+        }
+
+        unsigned char *Bytes() { return reinterpret_cast<unsigned char *>(storage.data()); }
+
+        AllocatorVector<Block, Allocator> storage;
+        size_t used = 0;
+        size_t count = 0;
+        size_t managed = 0;
+    };
+
+    /**
+     * @brief  BasicCommandBuffer using the default allocator.
+     */
+    using CommandBuffer = BasicCommandBuffer<DefaultAllocator>;
+
+#if DW_HAS_PMR
+    namespace pmr
+    {
+        using CommandBuffer = BasicCommandBuffer<Allocator>;
+    } // namespace pmr
+#endif
+} // namespace dw
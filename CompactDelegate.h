@@ -0,0 +1,387 @@
+#pragma once
+
+#include "Delegate.h"
+
+#include <cstdint>
+
+namespace dw
+{
+    /**
+     * @brief  Delegate one pointer wide, for objects that exist by the million and rarely have subscribers.
+     * @note   The pointer is either null (no subscriber), a plain function pointer (single subscriber convertible to
+     *         one, e.g. a function or a captureless lambda, stored inline), or a tagged pointer to one allocated block
+     *         holding a small header followed by the Callable array. The block grows by doubling and is freed when the
+     *         last subscriber leaves. A stateful allocator adds its own size to the object.
+     *         Like Delegate, it is not thread-safe and subscribers must not modify it while it is being called.
+     * @tparam Allocator    Allocator of the subscriber block.
+     * @tparam ReturnType   Return type of the subscribed functions.
+     * @tparam Params       Any number of arguments of any type.
+     */
+    template <typename Allocator, typename ReturnType, typename... Params>
+    class BasicCompactDelegate
+        : private std::allocator_traits<Allocator>::template rebind_alloc<typename std::aligned_storage<sizeof(Callable<ReturnType, Params...>), alignof(Callable<ReturnType, Params...>)>::type>
+    {
+    public:
+        using FunctionType = Callable<ReturnType, Params...>;
+        using FunctionPointer = ReturnType (*)(Params...);
+        using AllocatorType = Allocator;
+
+    private:
+        using Slot = typename std::aligned_storage<sizeof(FunctionType), alignof(FunctionType)>::type;
+        using SlotAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Slot>;
+        using SlotTraits = std::allocator_traits<SlotAllocator>;
+
+        /**
+         * @brief           First slot of a block, the subscribers follow it.
+         */
+        struct Header
+        {
+            uint32_t count;
+            uint32_t capacity;
+        };
+
+        static_assert(sizeof(Header) <= sizeof(Slot), "Block header does not fit a slot!");
+
+        static constexpr uintptr_t BlockTag = 1;
+
+        template <typename F>
+        using IsPointerLike = std::is_convertible<typename std::decay<F>::type, FunctionPointer>;
+
+    public:
+        BasicCompactDelegate() : BasicCompactDelegate(Allocator()) {}
+        explicit BasicCompactDelegate(const Allocator &allocator) : SlotAllocator(allocator) {}
+
+        BasicCompactDelegate(const BasicCompactDelegate &other)
+            : SlotAllocator(SlotTraits::select_on_container_copy_construction(other.Slots()))
+        {
+            CopyFrom(other);
+        }
+
+        BasicCompactDelegate(BasicCompactDelegate &&other) noexcept
+            : SlotAllocator(std::move(other.Slots())), bits(other.bits)
+        {
+            other.bits = 0;
+        }
+
+        BasicCompactDelegate &operator=(const BasicCompactDelegate &rhs)
+        {
+            if (this != &rhs)
+            {
+                Clear();
+                CopyFrom(rhs);
+            }
+            return *this;
+        }
+
+        BasicCompactDelegate &operator=(BasicCompactDelegate &&rhs) noexcept
+        {
+            if (this != &rhs)
+            {
+                Clear();
+                if (Slots() == rhs.Slots())
+                {
+                    bits = rhs.bits;
+                    rhs.bits = 0;
+                }
+                else
+                {
+                    CopyFrom(rhs);
+                    rhs.Clear();
+                }
+            }
+            return *this;
+        }
+
+        ~BasicCompactDelegate() { Clear(); }
+
+        /**
+         * @returns         Copy of the allocator of the subscriber block.
+         */
+        Allocator GetAllocator() const { return Allocator(Slots()); }
+
+        /**
+         * @returns         Count of subscribed functions.
+         */
+        size_t Count() const
+        {
+            return IsBlock() ? GetHeader().count : bits != 0;
+        }
+
+        /**
+         * @returns         true if no function is subscribed.
+         */
+        bool IsEmpty() const { return bits == 0; }
+
+        /**
+         * @returns         Count of bytes allocated for the subscribers.
+         */
+        size_t AllocatedBytes() const
+        {
+            return IsBlock() ? (GetHeader().capacity + 1) * sizeof(Slot) : 0;
+        }
+
+        /**
+         * @brief           Invoke all subscribed functions.
+         *
+         * @param  params:  Arguments of each subscribed function.
+         * @returns         Sum of their results, if *ReturnType* is not void.
+         */
+        ReturnType operator()(ArgumentType<Params>... params) const
+        {
+            return Call(std::is_void<ReturnType>(), params...);
+        }
+
+        /**
+         * @brief           Invoke all subscribed functions, combining their results.
+         *
+         * @param  combiner:    Result combiner (see SumResults), may stop the invocation early.
+         * @param  params:      Arguments of each subscribed function.
+         * @returns         Combined result.
+         */
+        template <typename Combiner, typename = typename std::enable_if<IsCombiner<Combiner, ReturnType>::value>::type>
+        typename Combiner::ResultType operator()(Combiner combiner, ArgumentType<Params>... params) const
+        {
+            if (IsBlock())
+            {
+                const FunctionType *functions = Functions();
+                for (uint32_t i = 0, count = GetHeader().count; i < count; i++)
+                {
+                    if (!combiner(functions[i].CallShared(params...)))
+                    {
+                        break;
+                    }
+                }
+            }
+            else if (bits)
+            {
+                combiner(Pointer()(params...));
+            }
+            return combiner.Result();
+        }
+
+        /**
+         * @brief           Subscribe *rhs*. Functions and captureless lambdas are stored as function pointers.
+         */
+        template <typename F>
+        BasicCompactDelegate &operator+=(F &&rhs)
+        {
+            Add(Target(std::forward<F>(rhs), IsPointerLike<F>()));
+            return *this;
+        }
+
+        /**
+         * @brief           Unsubscribe every subscription equal to *rhs* (see Callable::operator==).
+         */
+        template <typename F>
+        BasicCompactDelegate &operator-=(F &&rhs)
+        {
+            Remove(Target(std::forward<F>(rhs), IsPointerLike<F>()));
+            return *this;
+        }
+
+        /**
+         * @brief           Remove all subscribed functions and free the subscriber block.
+         */
+        void Clear()
+        {
+            if (IsBlock())
+            {
+                Header &header = GetHeader();
+                FunctionType *functions = Functions();
+                for (uint32_t i = 0; i < header.count; i++)
+                {
+                    functions[i].~FunctionType();
+                }
+                SlotTraits::deallocate(Slots(), Block(), header.capacity + 1);
+            }
+            bits = 0;
+        }
+
+    private:
+        static FunctionPointer Target(FunctionPointer function, std::true_type) { return function; }
+
+        template <typename F>
+        static FunctionType Target(F &&function, std::false_type) { return FunctionType(std::forward<F>(function)); }
+
+        void Add(FunctionPointer function)
+        {
+            uintptr_t address = reinterpret_cast<uintptr_t>(function);
+            if (!function)
+            {
+                return;
+            }
+            if (bits == 0 && (address & BlockTag) == 0)
+            {
+                bits = address;
+                return;
+            }
+            Add(FunctionType(function));
+        }
+
+        void Add(FunctionType function)
+        {
+            if (!function)
+            {
+                return;
+            }
+
+            uint32_t count = static_cast<uint32_t>(Count());
+            if (!IsBlock() || count == GetHeader().capacity)
+            {
+                Grow(count ? count * 2 : 1);
+            }
+            ::new (static_cast<void *>(Functions() + count)) FunctionType(std::move(function));
+            GetHeader().count = count + 1;
+        }
+
+        void Remove(FunctionPointer function)
+        {
+            if (!IsBlock())
+            {
+                if (bits && Pointer() == function)
+                {
+                    bits = 0;
+                }
+                return;
+            }
+            Remove(FunctionType(function));
+        }
+
+        void Remove(const FunctionType &function)
+        {
+            if (!IsBlock())
+            {
+                return;
+            }
+
+            Header &header = GetHeader();
+            FunctionType *functions = Functions();
+            uint32_t kept = 0;
+            for (uint32_t i = 0; i < header.count; i++)
+            {
+                if (functions[i] == function)
+                {
+                    continue;
+                }
+                if (kept != i)
+                {
+                    functions[kept] = std::move(functions[i]);
+                }
+                kept++;
+            }
+            for (uint32_t i = kept; i < header.count; i++)
+            {
+                functions[i].~FunctionType();
+            }
+            header.count = kept;
+
+            if (kept == 0)
+            {
+                Clear();
+            }
+        }
+
+        /**
+         * @brief           Move the subscribers into a new block of *capacity* functions.
+         */
+        void Grow(uint32_t capacity)
+        {
+            Slot *block = SlotTraits::allocate(Slots(), capacity + 1);
+            FunctionType *functions = reinterpret_cast<FunctionType *>(block + 1);
+            uint32_t count = 0;
+
+            if (IsBlock())
+            {
+                Header &header = GetHeader();
+                FunctionType *old = Functions();
+                for (; count < header.count; count++)
+                {
+                    ::new (static_cast<void *>(functions + count)) FunctionType(std::move(old[count]));
+                    old[count].~FunctionType();
+                }
+                SlotTraits::deallocate(Slots(), Block(), header.capacity + 1);
+            }
+            else if (bits)
+            {
+                ::new (static_cast<void *>(functions)) FunctionType(Pointer());
+                count = 1;
+            }
+
+            ::new (static_cast<void *>(block)) Header{count, capacity};
+            bits = reinterpret_cast<uintptr_t>(block) | BlockTag;
+        }
+
+        void CopyFrom(const BasicCompactDelegate &other)
+        {
+            if (!other.IsBlock())
+            {
+                bits = other.bits;
+                return;
+            }
+
+            uint32_t count = other.GetHeader().count;
+            const FunctionType *functions = other.Functions();
+            Grow(count);
+            for (uint32_t i = 0; i < count; i++)
+            {
+                ::new (static_cast<void *>(Functions() + i)) FunctionType(functions[i]);
+            }
+            GetHeader().count = count;
+        }
+
+        ReturnType Call(std::true_type, ArgumentType<Params>... params) const
+        {
+            if (IsBlock())
+            {
+                const FunctionType *functions = Functions();
+                for (uint32_t i = 0, count = GetHeader().count; i < count; i++)
+                {
+                    functions[i].CallShared(params...);
+                }
+            }
+            else if (bits)
+            {
+                Pointer()(params...);
+            }
+        }
+
+        ReturnType Call(std::false_type, ArgumentType<Params>... params) const
+        {
+            return (*this)(SumResults<ReturnType>(), params...);
+        }
+
+        bool IsBlock() const { return (bits & BlockTag) != 0; }
+        FunctionPointer Pointer() const { return reinterpret_cast<FunctionPointer>(bits); }
+        Slot *Block() const { return reinterpret_cast<Slot *>(bits & ~BlockTag); }
+        Header &GetHeader() const { return *reinterpret_cast<Header *>(Block()); }
+        FunctionType *Functions() const { return reinterpret_cast<FunctionType *>(Block() + 1); }
+
+        SlotAllocator &Slots() { return *this; }
+        const SlotAllocator &Slots() const { return *this; }
+
+        uintptr_t bits = 0;
+    };
+
+    /**
+     * @brief  BasicCompactDelegate of void functions using the default allocator.
+     */
+    template <typename... Params>
+    using CompactDelegate = BasicCompactDelegate<DefaultAllocator, void, Params...>;
+
+    /**
+     * @brief  BasicCompactDelegate of functions returning *ReturnType*, using the default allocator.
+     */
+    template <typename ReturnType, typename... Params>
+    using CompactRetDelegate = BasicCompactDelegate<DefaultAllocator, ReturnType, Params...>;
+
+#if DW_HAS_PMR
+    namespace pmr
+    {
+        template <typename... Params>
+        using CompactDelegate = BasicCompactDelegate<Allocator, void, Params...>;
+
+        template <typename ReturnType, typename... Params>
+        using CompactRetDelegate = BasicCompactDelegate<Allocator, ReturnType, Params...>;
+    } // namespace pmr
+#endif
+} // namespace dw
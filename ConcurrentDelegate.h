@@ -0,0 +1,315 @@
+#pragma once
+
+#include "Delegate.h"
+
+#include <atomic>
+#include <mutex>
+
+namespace dw
+{
+    /**
+     * @brief  Delegate that can be invoked from any number of threads while other threads subscribe and unsubscribe.
+     * @note   Invocation reads an immutable snapshot of the subscribers through an atomic pointer and never blocks
+     *         (wait-free). Every subscription change copies the snapshot, publishes the copy and retires the old one;
+     *         retired snapshots are reclaimed once every reader that could still see them has left (epoch based,
+     *         with per-thread striped reader counters so readers on different cores don't share cache lines).
+     *         Subscribing from inside a handler is allowed.
+     * @tparam Allocator    Allocator of the snapshots and their subscribers.
+     * @tparam Params       Any number of arguments of any type.
+     */
+    template <typename Allocator, typename... Params>
+    class BasicConcurrentDelegate
+    {
+    public:
+        using FunctionType = Callable<void, Params...>;
+        using AllocatorType = Allocator;
+
+    private:
+        using FunctionVector = AllocatorVector<FunctionType, Allocator>;
+
+        struct Snapshot
+        {
+            FunctionVector subscribers;
+            unsigned long long retiredAt = 0;
+            Snapshot *nextRetired = nullptr;
+        };
+
+        /**
+         * @brief           Reader counters for both epoch parities, one cache line per stripe.
+         */
+        struct alignas(64) ReaderStripe
+        {
+            std::atomic<size_t> readers[2];
+        };
+
+        /**
+         * @brief           Registers the calling thread as a reader of the current epoch for its lifetime.
+         */
+        class ReadGuard
+        {
+        public:
+            explicit ReadGuard(BasicConcurrentDelegate &owner)
+                : stripe(owner.stripes[StripeIndex()]), parity(owner.epoch.load() & 1)
+            {
+                stripe.readers[parity].fetch_add(1);
+            }
+
+            ~ReadGuard()
+            {
+                stripe.readers[parity].fetch_sub(1, std::memory_order_release);
+            }
+
+            ReadGuard(const ReadGuard &) = delete;
+            ReadGuard &operator=(const ReadGuard &) = delete;
+
+        private:
+            ReaderStripe &stripe;
+            size_t parity;
+        };
+
+    public:
+        /**
+         * @brief           Count of reader counter stripes (each one cache line wide).
+         */
+        static constexpr size_t StripeCount = 64;
+
+        BasicConcurrentDelegate() : BasicConcurrentDelegate(Allocator()) {}
+
+        explicit BasicConcurrentDelegate(const Allocator &allocator) : allocator(allocator)
+        {
+            for (auto &stripe : stripes)
+            {
+                stripe.readers[0].store(0, std::memory_order_relaxed);
+                stripe.readers[1].store(0, std::memory_order_relaxed);
+            }
+        }
+
+        BasicConcurrentDelegate(const BasicConcurrentDelegate &) = delete;
+        BasicConcurrentDelegate &operator=(const BasicConcurrentDelegate &) = delete;
+
+        /**
+         * @note            No thread may be invoking the delegate while it is destroyed.
+         */
+        ~BasicConcurrentDelegate()
+        {
+            DeleteSnapshot(current.load());
+            while (retired)
+            {
+                Snapshot *next = retired->nextRetired;
+                DeleteSnapshot(retired);
+                retired = next;
+            }
+        }
+
+        /**
+         * @brief           Invoke all subscribed functions. Wait-free, may be called from any thread.
+         *
+         * @param  params:  Arguments of each subscribed function.
+         */
+        void operator()(ArgumentType<Params>... params)
+        {
+            ReadGuard guard(*this);
+
+            Snapshot *snapshot = current.load();
+            if (!snapshot)
+            {
+                return;
+            }
+
+            for (auto &&i : snapshot->subscribers)
+            {
+                i.CallShared(params...);
+            }
+        }
+
+        /**
+         * @brief           Subscribe function to this delegate.
+         *
+         * @param  rhs:     Function to subscribe.
+         * @returns         Reference to the delegate instance.
+         */
+        BasicConcurrentDelegate &operator+=(const FunctionType &rhs)
+        {
+            Update([&rhs](FunctionVector &subscribers) { subscribers.push_back(rhs); });
+            return *this;
+        }
+
+        /**
+         * @brief           Subscribe multiple functions to this delegate, publishing them at once.
+         *
+         * @param  rhs:     Functions to subscribe.
+         * @returns         Reference to the delegate instance.
+         */
+        BasicConcurrentDelegate &operator+=(const std::initializer_list<FunctionType> &rhs)
+        {
+            Update([&rhs](FunctionVector &subscribers) { subscribers.insert(subscribers.end(), rhs.begin(), rhs.end()); });
+            return *this;
+        }
+
+        /**
+         * @brief           Unsubscribe choosen function from this delegate.
+         *
+         * @param  rhs:     Function to unsubscribe from this delegate.
+         * @returns         Reference to the delegate instance.
+         */
+        BasicConcurrentDelegate &operator-=(const FunctionType &rhs)
+        {
+            Update([&rhs](FunctionVector &subscribers) {
+                subscribers.erase(std::remove(subscribers.begin(), subscribers.end(), rhs), subscribers.end());
+            });
+            return *this;
+        }
+
+        /**
+         * @brief           Remove all subscribed functions from this delegate.
+         */
+        void Clear()
+        {
+            Update([](FunctionVector &subscribers) { subscribers.clear(); });
+        }
+
+        /**
+         * @returns         Count of functions in the current snapshot.
+         */
+        size_t Count()
+        {
+            ReadGuard guard(*this);
+
+            Snapshot *snapshot = current.load();
+            return snapshot ? snapshot->subscribers.size() : 0;
+        }
+
+        /**
+         * @brief           Free retired snapshots no reader can see anymore.
+         * @note            Called by every subscription change; call it explicitly to release memory after the last change.
+         */
+        void Reclaim()
+        {
+            std::lock_guard<std::mutex> lock(writerMutex);
+            Collect();
+        }
+
+    private:
+        template <typename Mutation>
+        void Update(Mutation mutate)
+        {
+            std::lock_guard<std::mutex> lock(writerMutex);
+
+            Snapshot *old = current.load(std::memory_order_relaxed);
+            Snapshot *next = NewSnapshot(old);
+
+            mutate(next->subscribers);
+            if (next->subscribers.empty())
+            {
+                DeleteSnapshot(next);
+                next = nullptr;
+            }
+
+            current.store(next);
+
+            if (old)
+            {
+                old->retiredAt = epoch.load(std::memory_order_relaxed);
+                old->nextRetired = retired;
+                retired = old;
+            }
+
+            Collect();
+        }
+
+        /**
+         * @brief           Advance the epoch while the readers of the previous one have left, then free every snapshot
+         *                  retired at least two epochs ago: each reader that could still hold it blocked one of those advances.
+         */
+        void Collect()
+        {
+            for (int i = 0; i < 2 && retired; ++i)
+            {
+                unsigned long long e = epoch.load(std::memory_order_relaxed);
+                if (Readers((e + 1) & 1) != 0)
+                {
+                    break;
+                }
+                epoch.store(e + 1);
+            }
+
+            unsigned long long e = epoch.load(std::memory_order_relaxed);
+            Snapshot **link = &retired;
+            while (*link)
+            {
+                Snapshot *snapshot = *link;
+                if (snapshot->retiredAt + 2 <= e)
+                {
+                    *link = snapshot->nextRetired;
+                    DeleteSnapshot(snapshot);
+                }
+                else
+                {
+                    link = &snapshot->nextRetired;
+                }
+            }
+        }
+
+        using SnapshotAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Snapshot>;
+
+        /**
+         * @returns         New snapshot holding a copy of the subscribers of *copied* (if any).
+         */
+        Snapshot *NewSnapshot(const Snapshot *copied)
+        {
+            SnapshotAllocator snapshots(allocator);
+            Snapshot *snapshot = std::allocator_traits<SnapshotAllocator>::allocate(snapshots, 1);
+            ::new (static_cast<void *>(snapshot)) Snapshot{copied ? FunctionVector(copied->subscribers, allocator) : FunctionVector(allocator)};
+            return snapshot;
+        }
+
+        void DeleteSnapshot(Snapshot *snapshot)
+        {
+            if (snapshot)
+            {
+                SnapshotAllocator snapshots(allocator);
+                snapshot->~Snapshot();
+                std::allocator_traits<SnapshotAllocator>::deallocate(snapshots, snapshot, 1);
+            }
+        }
+
+        size_t Readers(size_t parity) const
+        {
+            size_t count = 0;
+            for (auto &stripe : stripes)
+            {
+                count += stripe.readers[parity].load();
+            }
+            return count;
+        }
+
+        static size_t StripeIndex()
+        {
+            static std::atomic<size_t> nextIndex(0);
+            thread_local size_t index = nextIndex.fetch_add(1, std::memory_order_relaxed) % StripeCount;
+            return index;
+        }
+
+        std::atomic<Snapshot *> current{nullptr};
+        std::atomic<unsigned long long> epoch{0};
+        ReaderStripe stripes[StripeCount];
+
+        std::mutex writerMutex;
+        Snapshot *retired = nullptr;
+        Allocator allocator;
+    };
+
+    /**
+     * @brief  BasicConcurrentDelegate using the default allocator.
+     */
+    template <typename... Params>
+    using ConcurrentDelegate = BasicConcurrentDelegate<DefaultAllocator, Params...>;
+
+#if DW_HAS_PMR
+    namespace pmr
+    {
+        template <typename... Params>
+        using ConcurrentDelegate = BasicConcurrentDelegate<Allocator, Params...>;
+    } // namespace pmr
+#endif
+} // namespace dw
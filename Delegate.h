@@ -5,608 +5,3187 @@
 #include <tuple>
 #include <iostream>
 #include <functional>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <unordered_map>
+#include <utility>
+#include <memory>
+#include <exception>
+#include <cassert>
+
+#if defined(__has_include)
+#if __has_include(<span>) && __cplusplus >= 202002L
+#include <span>
+#define DW_HAS_STD_SPAN 1
+#endif
+#if __has_include(<memory_resource>) && __cplusplus >= 201703L
+#include <cstddef>
+#include <memory_resource>
+#define DW_HAS_PMR 1
+#endif
+#endif
 
 namespace dw
 {
+    /**
+     * @brief  Type a delegate takes its argument *T* as: const reference for values, unchanged for references.
+     * @note   Arguments are bound once by the invocation and the same objects are handed to every subscriber.
+     */
+    template <typename T>
+    using ArgumentType = typename std::conditional<std::is_reference<T>::value, T, const T &>::type;
+
+    /**
+     * @brief  Type-erased callable with fixed-size inline storage. Never allocates.
+     * @note   Holds function pointers, captureless lambdas and functors/capturing lambdas up to
+     *         *Capacity* bytes. Larger targets are rejected at compile time.
+     * @tparam ReturnType   Return type of the callable.
+     * @tparam Params       Any number of arguments of any type.
+     */
     template <typename ReturnType, typename... Params>
-    class SimpleDelegateBase
+    class Callable
     {
-    protected:
+    public:
         /**
-         * @brief           Type defining a pointer to the function with the same arguments as Delegate's
+         * @brief           Size in bytes of the inline storage for the target.
          */
-        typedef ReturnType (*FunctionType)(Params...);
-        //using FunctionType = std::function<ReturnType(Params...)>;
+        static constexpr size_t Capacity = 2 * sizeof(void *);
+
+    private:
+        union Storage
+        {
+            void *pointers[2];
+            long long integer;
+            double number;
+            unsigned char bytes[Capacity];
+        };
+
+        enum class Operation
+        {
+            Copy,
+            Move,
+            Destroy
+        };
 
         /**
-         * @brief           **std::vector** of functions that are subscribed to this delegate.
+         * @brief           Type the invoker takes argument *T* as: values by reference, so it can move or share them.
          */
-        std::vector<FunctionType> subscribers;
+        template <typename T>
+        using Forwarded = typename std::conditional<std::is_reference<T>::value, T, T &>::type;
 
-        SimpleDelegateBase() = default;
-    };
+        typedef ReturnType (*InvokerType)(void *, bool shared, Forwarded<Params>...);
+        typedef void (*ManagerType)(Operation, Storage &, Storage &);
+
+        template <typename F, typename = void>
+        struct IsInvocable : std::false_type
+        {
+        };
+
+        template <typename F>
+        struct IsInvocable<F, decltype(void(std::declval<F &>()(std::declval<Params>()...)))>
+            : std::integral_constant<bool, std::is_void<ReturnType>::value ||
+                                               std::is_convertible<decltype(std::declval<F &>()(std::declval<Params>()...)), ReturnType>::value>
+        {
+        };
+
+        template <typename F>
+        using EnableIfTarget = typename std::enable_if<!std::is_same<typename std::decay<F>::type, Callable>::value &&
+                                                       IsInvocable<typename std::decay<F>::type>::value>::type;
 
-    template <typename... Params>
-    class SimpleDelegate : public SimpleDelegateBase<void, Params...>
-    {
     public:
-        using Parent = SimpleDelegateBase<void, Params...>;
-        using Parent::subscribers;
-        using typename Parent::FunctionType;
+        Callable() = default;
+
+        Callable(std::nullptr_t) {}
 
         /**
-         * @brief           Invoke all subscribed functions.
-         * 
-         * @param  params:  Arguments of each subscribed function.
+         * @brief           Store a copy of *function*.
+         * @param  function:    Function pointer, lambda or functor invocable with *Params*.
          */
-        void operator()(Params... params)
+        template <typename F, typename = EnableIfTarget<F>>
+        Callable(F &&function)
         {
-            for (auto &&i : subscribers)
+            using Target = typename std::decay<F>::type;
+
+            static_assert(sizeof(Target) <= Capacity, "Callable target does not fit the inline storage!");
+            static_assert(alignof(Target) <= alignof(Storage), "Callable target is over-aligned!");
+            static_assert(std::is_nothrow_move_constructible<Target>::value, "Callable target must be nothrow move constructible!");
+
+            if (IsNull(function))
             {
-                i(params...);
+                return;
             }
+
+            ::new (static_cast<void *>(&storage)) Target(std::forward<F>(function));
+            invoker = &Invoke<Target>;
+            manager = std::is_trivially_copyable<Target>::value && std::is_trivially_destructible<Target>::value
+                          ? nullptr
+                          : &Manage<Target>;
         }
 
-        /**
-         * @brief           Subscribe function to this delegate.
-         * 
-         * @param  rhs:     Function to subscribe.
-         * @returns         Reference to the delegate instance.
-         */
-        SimpleDelegate &operator+=(const FunctionType &rhs)
+        Callable(const Callable &other) : invoker(other.invoker), manager(other.manager)
         {
-            this->subscribers.push_back(rhs);
-            return *this;
+            if (manager)
+            {
+                manager(Operation::Copy, storage, const_cast<Storage &>(other.storage));
+            }
+            else
+            {
+                storage = other.storage;
+            }
         }
 
-        /**
-         * @brief           Unsubscribe choosen function from this delegate.
-         * 
-         * @param  rhs:     Function to unsubscribe from this delegate.
-         * @returns         Reference to the delegate instance.
-         */
-        SimpleDelegate &operator-=(const FunctionType &rhs)
+        Callable(Callable &&other) noexcept
         {
-            subscribers.erase(std::remove(subscribers.begin(), subscribers.end(), rhs), subscribers.end());
-            return *this;
+            Relocate(other);
         }
-    };
 
-    template <typename ReturnType, typename... Params>
-    class DelegateBase : public SimpleDelegateBase<ReturnType, Params...>
-    {
-        template <typename... T>
-        struct FunctionParams
+        ~Callable()
         {
-            size_t index = -1;
-            std::tuple<T...> parameters;
-        };
-
-    protected:
-        using Parent = SimpleDelegateBase<ReturnType, Params...>;
-        using Parent::subscribers;
-        using typename Parent::FunctionType;
-
-        /**
-         * @brief           Vector of parameters updated when each function is subscribed to this delegate using Subscribe() method.
-         */
-        std::vector<FunctionParams<Params...>> parameters;
+            Reset();
+        }
 
-    public:
-        const std::vector<FunctionType> &GetSubscribers() const { return this->subscribers; }
+        Callable &operator=(const Callable &rhs)
+        {
+            if (this != &rhs)
+            {
+                Callable copy(rhs);
+                *this = std::move(copy);
+            }
+            return *this;
+        }
 
-        /**
-         * @brief           Subscribe all functions (subscribers) from other delegate to this delegate.
-         * 
-         * @param  other:   Other delegate reference.
-         */
-        void Combine(const DelegateBase &other)
+        Callable &operator=(Callable &&rhs) noexcept
         {
-            for (size_t i = 0; i < other.subscribers.size(); i++)
+            if (this != &rhs)
             {
-                this->subscribers.push_back(other.subscribers[i]);
-                AttachParameters(other.parameters[i].parameters, std::index_sequence_for<Params...>());
+                Reset();
+                Relocate(rhs);
             }
+            return *this;
         }
 
         /**
-         * @brief           Subscribes single function and saves single parameters pack.
-         * @note   
-         * @param  function:    Function to subscribe.
-         * @param  params:      Parameters pack for the function to subscribe.
-         * @retval None
+         * @brief           Call the stored target.
+         * @note            Calling an empty Callable is undefined behaviour.
          */
-        void Subscribe(const FunctionType &function, Params... params)
+        ReturnType operator()(Params... params) const
         {
-            this->subscribers.push_back(function);
-            AttachParameters(std::tuple<Params...>(params...), std::index_sequence_for<Params...>());
+            return invoker(const_cast<Storage *>(&storage), false, static_cast<Forwarded<Params>>(params)...);
         }
 
         /**
-         * @brief           Subscribes multiple functions and saves single parameters pack.
-         * @note   
-         * @param  functions:   Multiple functions to subscribe.
-         * @param  params:      Parameters pack for the functions to subscribe.
-         * @retval None
+         * @brief           Call the stored target with arguments shared with other calls, as delegates do.
+         * @note            Values are passed as const lvalues when the target accepts them, so a target taking
+         *                  *const T&* copies nothing; otherwise they are copied. A target taking a non-copyable
+         *                  parameter by value can't share it and must only be called with operator(): calling it here
+         *                  asserts in debug builds and calls std::terminate().
+         *                  Calling an empty Callable is undefined behaviour.
          */
-        void Subscribe(const std::initializer_list<FunctionType> &functions, Params... params)
+        ReturnType CallShared(ArgumentType<Params>... params) const
         {
-            for (auto &&d : functions)
-            {
-                this->subscribers.push_back(d);
-                AttachParameters(std::tuple<Params...>(params...), std::index_sequence_for<Params...>());
-            }
+            return invoker(const_cast<Storage *>(&storage), true, const_cast<Forwarded<Params>>(params)...);
         }
 
         /**
-         * @brief           Subscribes single function and save multiple parameters packs.
-         * @note   
-         * @param  function:    Function to subscribe.
-         * @param  params:      Multiple parameter packs for the function to subscribe.
-         * @retval None
+         * @brief           Destroy the stored target, leaving this Callable empty.
          */
-        void Subscribe(const FunctionType &function, std::vector<std::tuple<Params...>> params)
+        void Reset()
         {
-            for (size_t i = 0; i < params.size(); i++)
+            if (manager)
             {
-                this->subscribers.push_back(function);
-                AttachParameters(params[i], std::index_sequence_for<Params...>());
+                manager(Operation::Destroy, storage, storage);
             }
+            invoker = nullptr;
+            manager = nullptr;
+            storage = Storage();
         }
 
+        explicit operator bool() const { return invoker != nullptr; }
+
         /**
-         * @brief           Call all subscribed functions of this delegate that have parameters saved on subscription.
+         * @brief           Two callables are equal when both are empty, or when both hold a trivially copyable
+         *                  target of the same type with bitwise equal state (e.g. the same function pointer or lambda).
+         * @note            Callables holding targets that are not trivially copyable are only equal to themselves.
          */
-        void Invoke()
+        bool operator==(const Callable &rhs) const
         {
-            for (size_t i = 0; i < parameters.size(); i++)
+            if (this == &rhs || (!invoker && !rhs.invoker))
             {
-                HelperInvoke(parameters[i].parameters, parameters[i].index,
-                             std::index_sequence_for<Params...>());
+                return true;
             }
-            return;
+            return invoker == rhs.invoker && !manager && !rhs.manager &&
+                   std::memcmp(storage.bytes, rhs.storage.bytes, Capacity) == 0;
         }
 
+        bool operator!=(const Callable &rhs) const { return !(*this == rhs); }
+
         /**
-         * @brief           Remove *count* functions from the back or front.
-         * @note   
-         * @param  count:       Count of functions to remove.
-         * @param  fromBack:    If *true* - removing will be performed from back of the subscribers vector. From front otherwise.
-         * @retval None
+         * @brief           Two callables share a target when they are equal, or when both hold a target of the same type
+         *                  that is not trivially copyable (the same code called with a different state).
+         * @note            Calls of callables sharing a target go through the same indirect branch.
          */
-        void Remove(int count = 1, bool fromBack = true)
+        bool SameTarget(const Callable &rhs) const
         {
-            int adjustedCount = count < subscribers.size() ? count : subscribers.size() - 1;
+            return *this == rhs || (invoker == rhs.invoker && manager && rhs.manager);
+        }
 
-            if (!fromBack)
+        /**
+         * @returns         Hash consistent with SameTarget().
+         */
+        size_t TargetHash() const
+        {
+            size_t hash = std::hash<InvokerType>()(invoker);
+            if (!manager)
             {
-                for (size_t i = 0; i < adjustedCount; ++i)
+                for (void *pointer : storage.pointers)
                 {
-                    DetachParameters(0);
+                    hash = hash * 31 + std::hash<void *>()(pointer);
                 }
-                subscribers.erase(subscribers.begin(), subscribers.begin() + count);
-                return;
             }
+            return hash;
+        }
 
-            for (size_t i = 0; i < adjustedCount; ++i)
+    private:
+        template <typename F>
+        static bool IsNull(const F &function) { return IsNull(function, std::is_pointer<F>()); }
+        template <typename F>
+        static bool IsNull(const F &function, std::true_type) { return function == nullptr; }
+        template <typename F>
+        static bool IsNull(const F &, std::false_type) { return false; }
+
+        void Relocate(Callable &other)
+        {
+            invoker = other.invoker;
+            manager = other.manager;
+            if (manager)
             {
-                DetachParameters(parameters.size() - 1);
+                manager(Operation::Move, storage, other.storage);
             }
-
-            for (size_t i = 0; i < adjustedCount; i++)
+            else
             {
-                subscribers.pop_back();
+                storage = other.storage;
             }
+            other.invoker = nullptr;
+            other.manager = nullptr;
+            other.storage = Storage();
         }
 
-        /**
-         * @brief  Is not implemented yet.
-         * @note   
-         * @param  subscriber: 
-         */
-        void Remove(const FunctionType &subscriber)
+        template <typename Target>
+        static ReturnType Invoke(void *target, bool shared, Forwarded<Params>... params)
         {
-            std::cout << "Removing " << &subscriber << std::endl;
-            subscribers.erase(
-                std::remove_if(
-                    subscribers.begin(),
-                    subscribers.end(),
-                    [subscriber](const FunctionType &x) { return &x == &subscriber; }),
-                subscribers.end());
-            for (auto i : subscribers)
+            Target &function = *static_cast<Target *>(target);
+            if (shared)
             {
-                std::cout << "Address = " << &i << std::endl;
+                return Share(function, ShareMode<Target>(), std::forward<Forwarded<Params>>(params)...);
             }
+            return static_cast<ReturnType>(function(std::forward<Params>(params)...));
         }
 
-        /**
-         * @brief           Remove all subscribers of this delegate appearing in the ***subscribers*** parameter.
-         * @note            Is not implemented yet.
-         * @param  subscribers: *std*::vector of functions that must be removed from the delegate.
-         */
-        void Remove(const std::vector<FunctionType> &subscribers)
+        template <typename F, typename = void>
+        struct IsSharable : std::false_type
         {
-            for (auto &s : subscribers)
-            {
-                this->subscribers.erase(
-                    std::remove_if(
-                        this->subscribers.begin(),
-                        this->subscribers.end(),
-                        [s](const FunctionType &x) { return &s == &x; }),
-                    this->subscribers.end());
-            }
-        }
+        };
 
-        /**
-         * @brief           Remove all subscribed functions from this delegate.
-         * @returns *None*
-         */
-        void Clear()
+        template <typename F>
+        struct IsSharable<F, decltype(void(std::declval<F &>()(std::declval<ArgumentType<Params>>()...)))> : std::true_type
+        {
+        };
+
+        template <typename Target>
+        static ReturnType Share(Target &function, std::integral_constant<int, 0>, Forwarded<Params>... params)
         {
-            this->subscribers.clear();
-            this->parameters.clear();
+            return static_cast<ReturnType>(function(std::forward<ArgumentType<Params>>(params)...));
         }
 
-        /**
-         * @brief           Subscribe function to this delegate.
-         * 
-         * @param  rhs:     Function to subscribe.
-         * @returns         Reference to the delegate instance.
-         */
-        DelegateBase &operator+=(const FunctionType &rhs)
+        template <typename Target>
+        static ReturnType Share(Target &function, std::integral_constant<int, 1>, Forwarded<Params>... params)
         {
-            this->subscribers.push_back(rhs);
-            return *this;
+            return static_cast<ReturnType>(function(Copy<Params>(params)...));
         }
 
-        DelegateBase &operator+=(const std::initializer_list<FunctionType> &rhs)
+        template <typename Target>
+        static ReturnType Share(Target &, std::integral_constant<int, 2>, Forwarded<Params>...)
         {
-            for (auto x : rhs)
-            {
-                this->subscribers.push_back(x);
-            }
-            return *this;
+            assert(!"A shared argument can't be copied: call targets taking non-copyable parameters by value with operator()");
+            std::terminate();
         }
 
         /**
-         * @brief           Unsubscribe choosen function from this delegate.
-         * 
-         * @param  rhs:     Function to unsubscribe from this delegate.
-         * @returns         Reference to the delegate instance.
+         * @brief           true if every value parameter of *T* can be copied (references are passed as they are).
          */
-        DelegateBase &operator-=(const FunctionType &rhs)
+        template <typename... T>
+        struct AreCopyable : std::true_type
         {
-            subscribers.erase(std::remove(subscribers.begin(), subscribers.end(), rhs), subscribers.end());
-            return *this;
-        }
+        };
 
-        DelegateBase &operator-=(const std::initializer_list<FunctionType> &rhs)
+        template <typename T, typename... Rest>
+        struct AreCopyable<T, Rest...>
+            : std::integral_constant<bool, (std::is_reference<T>::value || std::is_copy_constructible<T>::value) && AreCopyable<Rest...>::value>
         {
-            auto toRemove = [&](const FunctionType &func) -> bool {
-                return std::find(rhs.begin(), rhs.end(), func) != rhs.end();
-            };
+        };
 
-            subscribers.erase(std::remove_if(subscribers.begin(), subscribers.end(), toRemove), subscribers.end());
-            return *this;
+        /**
+         * @brief           How a target is called with shared arguments: 0 if it accepts them as const lvalues,
+         *                  1 if it takes copyable values (each call gets a copy), 2 if it can't share them.
+         */
+        template <typename Target>
+        using ShareMode = std::integral_constant<int, IsSharable<Target>::value ? 0 : AreCopyable<Params...>::value ? 1 : 2>;
+
+        /**
+         * @brief           Copy of a shared value argument, or the argument itself if it is a reference.
+         */
+        template <typename T, typename Value>
+        static typename std::conditional<std::is_reference<T>::value, T, typename std::decay<T>::type>::type Copy(Value &value)
+        {
+            return static_cast<typename std::conditional<std::is_reference<T>::value, T, const Value &>::type>(value);
         }
 
-        DelegateBase &operator++()
+        template <typename Target>
+        static void Manage(Operation operation, Storage &destination, Storage &source)
         {
-            if (subscribers.empty())
+            switch (operation)
             {
-                return *this;
+            case Operation::Copy:
+                ::new (static_cast<void *>(&destination)) Target(*reinterpret_cast<const Target *>(&source));
+                break;
+            case Operation::Move:
+                ::new (static_cast<void *>(&destination)) Target(std::move(*reinterpret_cast<Target *>(&source)));
+                reinterpret_cast<Target *>(&source)->~Target();
+                break;
+            case Operation::Destroy:
+                reinterpret_cast<Target *>(&destination)->~Target();
+                break;
             }
+        }
 
-            FunctionType newDel = subscribers.front();
+        InvokerType invoker = nullptr;
+        ManagerType manager = nullptr;
+        Storage storage = Storage();
+    };
 
-            if (parameters.empty())
-            {
-                subscribers.insert(subscribers.begin(), newDel);
-                return *this;
-            }
+    /**
+     * @brief  Generation-tagged handle of a single subscription.
+     * @note   Stays valid (and keeps referring to the same subscription) while other subscriptions are added or removed.
+     *         Once its subscription is removed, the handle no longer matches anything, even if its slot is reused.
+     *         A handle must only be used with the delegate that returned it.
+     */
+    struct SubscriptionHandle
+    {
+        uint32_t index = UINT32_MAX;
+        uint32_t generation = 0;
 
-            subscribers.insert(subscribers.begin(), newDel);
-            AttachParameters(parameters.front().parameters, std::index_sequence_for<Params...>());
+        bool operator==(const SubscriptionHandle &rhs) const { return index == rhs.index && generation == rhs.generation; }
+        bool operator!=(const SubscriptionHandle &rhs) const { return !(*this == rhs); }
+    };
 
-            return *this;
-        }
+    /**
+     * @brief  Movable RAII owner of a subscription, unsubscribing it in O(1) when destroyed.
+     * @note   Works with any delegate providing *Unsubscribe(SubscriptionHandle)*. Doesn't allocate.
+     *         The delegate must outlive the connection (or the connection must be released first).
+     */
+    class ScopedConnection
+    {
+    public:
+        ScopedConnection() = default;
 
-        DelegateBase &operator++(int)
+        /**
+         * @brief           Take ownership of the subscription of *handle* in *owner*.
+         */
+        template <class DelegateType>
+        ScopedConnection(DelegateType &owner, SubscriptionHandle handle)
+            : owner(&owner), disconnect(&Disconnect<DelegateType>), handle(handle)
         {
-            if (subscribers.empty())
-            {
-                return *this;
-            }
-
-            FunctionType newDel = subscribers.back();
-
-            if (parameters.empty())
-            {
-                subscribers.push_back(newDel);
-                return *this;
-            }
+        }
 
-            subscribers.push_back(newDel);
-            AttachParameters(parameters.back().parameters, std::index_sequence_for<Params...>());
+        ScopedConnection(const ScopedConnection &) = delete;
+        ScopedConnection &operator=(const ScopedConnection &) = delete;
 
-            return *this;
+        ScopedConnection(ScopedConnection &&other) noexcept
+            : owner(other.owner), disconnect(other.disconnect), handle(other.handle)
+        {
+            other.owner = nullptr;
         }
 
-        DelegateBase &operator--()
+        ScopedConnection &operator=(ScopedConnection &&rhs) noexcept
         {
-            if (subscribers.empty())
-            {
-                return *this;
-            }
-
-            if (parameters.empty())
+            if (this != &rhs)
             {
-                subscribers.pop_back();
-                return *this;
+                Disconnect();
+                owner = rhs.owner;
+                disconnect = rhs.disconnect;
+                handle = rhs.handle;
+                rhs.owner = nullptr;
             }
-
-            int index = parameters.back().index;
-            parameters.pop_back();
-            subscribers.erase(subscribers.begin() + index);
-
             return *this;
         }
 
-        DelegateBase &operator--(int)
+        ~ScopedConnection()
         {
-            if (subscribers.empty())
-            {
-                return *this;
-            }
-
-            if (parameters.empty())
-            {
-                subscribers.pop_back();
-                return *this;
-            }
-
-            int index = parameters.back().index;
-            parameters.pop_back();
-            subscribers.erase(subscribers.begin() + index);
-
-            return *this;
+            Disconnect();
         }
 
         /**
-         * @brief           Signature of comparable delegates must match exactly.
-         * @param  rhs:     Other delegate.
-         * @returns         true if count of subscribers of this delegate is less than other's.
+         * @brief           Unsubscribe now instead of on destruction.
          */
-        bool operator<(const DelegateBase &rhs)
+        void Disconnect()
         {
-            return subscribers.size() < rhs.subscribers.size();
+            if (owner)
+            {
+                disconnect(owner, handle);
+                owner = nullptr;
+            }
         }
 
         /**
-         * @brief           Signature of comparable delegates must match exactly.
-         * @param  rhs:     Other delegate.
-         * @returns         true if count of subscribers of this delegate is less or equals to other's.
+         * @brief           Stop owning the subscription without unsubscribing it.
+         * @returns         Handle of the subscription.
          */
-        bool operator<=(const DelegateBase &rhs)
+        SubscriptionHandle Release()
         {
-            return subscribers.size() <= rhs.subscribers.size();
+            owner = nullptr;
+            return handle;
         }
 
+        SubscriptionHandle GetHandle() const { return handle; }
+
         /**
-         * @brief           Signature of comparable delegates must match exactly.
-         * @param  rhs:     Other delegate.
-         * @returns         true if count of subscribers of this delegate is more than other's.
+         * @returns         true while this connection owns a subscription.
          */
-        bool operator>(const DelegateBase &rhs)
+        explicit operator bool() const { return owner != nullptr; }
+
+    private:
+        template <class DelegateType>
+        static void Disconnect(void *owner, SubscriptionHandle handle)
         {
-            return subscribers.size() > rhs.subscribers.size();
+            static_cast<DelegateType *>(owner)->Unsubscribe(handle);
         }
 
-        /**
-         * @brief           Signature of comparable delegates must match exactly.
-         * @param  rhs:     Other delegate.
-         * @returns         true if count of subscribers of this delegate is more or equals to other's.
+        void *owner = nullptr;
+        void (*disconnect)(void *, SubscriptionHandle) = nullptr;
+        SubscriptionHandle handle;
+    };
+
+    /**
+     * @brief  Executor running every range on the calling thread.
+     * @note   Executors used by the InvokeParallel() methods and ParallelPolicy provide
+     *         *ParallelFor(count, grain, body)*: call *body(begin, end)* for disjoint ranges covering [0, count),
+     *         each about *grain* long (0 lets the executor choose), and return once all of them completed.
+     *         Executors used by the InvokeAsync() methods provide *Post(Callable<void> task)*: run *task* later,
+     *         on any thread.
+     *         See ThreadPool.h for a work-stealing thread pool.
+     */
+    struct SequentialExecutor
+    {
+        template <typename Body>
+        void ParallelFor(size_t count, size_t, const Body &body)
+        {
+            if (count)
+            {
+                body(0, count);
+            }
+        }
+
+        void Post(const Callable<void> &task) { task(); }
+    };
+
+    /**
+     * @brief  Passed as first argument of operator() to call the subscribers in parallel on *executor*.
+     * @tparam Executor     Type providing ParallelFor() (see SequentialExecutor).
+     */
+    template <typename Executor>
+    struct ParallelPolicy
+    {
+        Executor &executor;
+        size_t grain;
+
+        /**
+         * @brief       Reduce results of parallel calls over a fixed tree, see DeterministicParallel().
          */
-        bool operator>=(const DelegateBase &rhs)
+        bool deterministic;
+    };
+
+    /**
+     * @brief           Make a policy calling the subscribers in parallel on *executor*, *grain* subscribers per task.
+     */
+    template <typename Executor>
+    ParallelPolicy<Executor> Parallel(Executor &executor, size_t grain = 0)
+    {
+        return ParallelPolicy<Executor>{executor, grain, false};
+    }
+
+    /**
+     * @brief           Make a policy calling the subscribers in parallel on *executor* and reducing their results
+     *                  reproducibly: partial results of consecutive runs of *grain* subscribers (64 if 0) are combined
+     *                  over a fixed pairwise tree, whatever the count of threads and the order chunks complete in.
+     */
+    template <typename Executor>
+    ParallelPolicy<Executor> DeterministicParallel(Executor &executor, size_t grain = 0)
+    {
+        return ParallelPolicy<Executor>{executor, grain, true};
+    }
+
+    /**
+     * @brief  Allocator of the delegates that don't name one.
+     * @note   Every delegate rebinds its allocator to the types it stores, so its value type doesn't matter.
+     */
+    using DefaultAllocator = std::allocator<char>;
+
+    /**
+     * @brief  std::vector storing *T* with *Allocator* rebound to it.
+     */
+    template <typename T, typename Allocator>
+    using AllocatorVector = std::vector<T, typename std::allocator_traits<Allocator>::template rebind_alloc<T>>;
+
+    template <typename Allocator, typename ReturnType, typename... Params>
+    class SimpleDelegateBase
+    {
+    protected:
+        /**
+         * @brief           Type of the stored subscriber: any function, lambda or functor with the same arguments as Delegate's
+         *                  that fits into Callable's inline storage.
+         */
+        using FunctionType = Callable<ReturnType, Params...>;
+
+        /**
+         * @brief           Entry of the slot map translating subscription handles to positions in ***subscribers***.
+         * @note            Free slots are chained through *position*.
+         */
+        struct SubscriptionSlot
+        {
+            uint32_t position;
+            uint32_t generation;
+        };
+
+        static constexpr uint32_t NoSlot = UINT32_MAX;
+
+        /**
+         * @brief           **std::vector** of functions that are subscribed to this delegate.
+         * @note            Unsubscribed functions are left empty until the vector is compacted, so invocation skips empty entries.
+         */
+        AllocatorVector<FunctionType, Allocator> subscribers;
+
+        /**
+         * @brief           Slot owning each entry of ***subscribers*** (*NoSlot* for removed entries).
+         */
+        AllocatorVector<uint32_t, Allocator> subscriberSlots;
+
+        /**
+         * @brief           Slot map of all subscriptions, indexed by SubscriptionHandle::index.
+         */
+        AllocatorVector<SubscriptionSlot, Allocator> slots;
+
+        uint32_t freeSlots = NoSlot;
+        size_t removedSubscribers = 0;
+
+        SimpleDelegateBase() : SimpleDelegateBase(Allocator()) {}
+
+        explicit SimpleDelegateBase(const Allocator &allocator)
+            : subscribers(allocator), subscriberSlots(allocator), slots(allocator)
         {
-            return subscribers.size() >= rhs.subscribers.size();
         }
 
+    public:
+        using AllocatorType = Allocator;
+
         /**
-         * @brief           Signature of comparable delegates must match exactly.
-         * @param  rhs:     Other delegate.
-         * @returns         true if subscribers of this delegate are equal to other's.
+         * @returns         Allocator of the subscribers and parameters storage.
          */
-        bool operator==(const DelegateBase &rhs)
+        Allocator GetAllocator() const { return Allocator(subscribers.get_allocator()); }
+
+        /**
+         * @returns         Count of subscribed functions.
+         */
+        size_t Count() const { return subscribers.size() - removedSubscribers; }
+
+        /**
+         * @returns         true if the subscription of *handle* was not removed yet.
+         */
+        bool IsSubscribed(SubscriptionHandle handle) const
         {
-            return subscribers == rhs.subscribers;
+            return handle.index < slots.size() && slots[handle.index].generation == handle.generation;
         }
 
+    protected:
         /**
-         * @brief           Signature of comparable delegates must match exactly.
-         * @param  rhs:     Other delegate.
-         * @returns         true if subscribers of this delegate are not-equal to other's.
+         * @brief           Append *function* to the subscribers.
+         * @returns         Handle of the new subscription.
          */
-        bool operator!=(const DelegateBase &rhs)
+        SubscriptionHandle AddSubscriber(const FunctionType &function)
         {
-            return subscribers != rhs.subscribers;
+            SubscriptionHandle handle = AcquireSlot(static_cast<uint32_t>(subscribers.size()));
+            subscribers.push_back(function);
+            subscriberSlots.push_back(handle.index);
+            return handle;
         }
 
         /**
-         * @brief           Transfer all subscribers of other delegate to this delegate. Will clear subscribers from other delegate.
-         * @param  rhs:     Other delegate.
-         * @returns         Pointer to this delegate.
+         * @brief           Insert *function* at *position* of the subscribers, shifting the following ones.
+         * @returns         Handle of the new subscription.
          */
-        DelegateBase &operator<<(DelegateBase &rhs)
+        SubscriptionHandle InsertSubscriber(size_t position, const FunctionType &function)
         {
-            if (this != &rhs)
+            SubscriptionHandle handle = AcquireSlot(static_cast<uint32_t>(position));
+            subscribers.insert(subscribers.begin() + position, function);
+            subscriberSlots.insert(subscriberSlots.begin() + position, handle.index);
+            UpdatePositions(position + 1);
+            return handle;
+        }
+
+        /**
+         * @brief           Remove the subscription of *handle* in O(1). Its entry is emptied and dropped on the next compaction.
+         * @returns         true if the subscription existed.
+         */
+        bool ReleaseSubscriber(SubscriptionHandle handle)
+        {
+            if (!IsSubscribed(handle))
             {
-                this->Combine(rhs);
-                rhs.Clear();
+                return false;
+            }
+
+            uint32_t position = slots[handle.index].position;
+            subscribers[position].Reset();
+            subscriberSlots[position] = NoSlot;
+            ReleaseSlot(handle.index);
+            removedSubscribers++;
+            return true;
+        }
+
+        /**
+         * @returns         true if removed entries take more than half of the subscribers.
+         */
+        bool NeedsCompaction() const { return removedSubscribers * 2 > subscribers.size(); }
+
+        /**
+         * @brief           Remove every subscriber at *position* for which *predicate(position)* returns true and drop emptied
+         *                  entries, keeping the order of the remaining subscribers.
+         * @returns         Count of removed subscribers.
+         */
+        template <typename Predicate>
+        size_t RemoveSubscribersIf(Predicate predicate)
+        {
+            size_t removed = 0;
+            size_t kept = 0;
+
+            for (size_t i = 0; i < subscribers.size(); ++i)
+            {
+                uint32_t slot = subscriberSlots[i];
+                if (slot == NoSlot)
+                {
+                    continue;
+                }
+                if (predicate(i))
+                {
+                    ReleaseSlot(slot);
+                    removed++;
+                    continue;
+                }
+                if (kept != i)
+                {
+                    subscribers[kept] = std::move(subscribers[i]);
+                    subscriberSlots[kept] = slot;
+                    slots[slot].position = static_cast<uint32_t>(kept);
+                }
+                kept++;
+            }
+
+            subscribers.erase(subscribers.begin() + kept, subscribers.end());
+            subscriberSlots.erase(subscriberSlots.begin() + kept, subscriberSlots.end());
+            removedSubscribers = 0;
+            return removed;
+        }
+
+        /**
+         * @brief           Drop emptied entries of unsubscribed functions.
+         */
+        void CompactSubscribers()
+        {
+            RemoveSubscribersIf([](size_t) { return false; });
+        }
+
+        /**
+         * @brief           Remove all subscribers, invalidating every handle.
+         */
+        void ClearSubscribers()
+        {
+            for (uint32_t slot : subscriberSlots)
+            {
+                if (slot != NoSlot)
+                {
+                    ReleaseSlot(slot);
+                }
+            }
+            subscribers.clear();
+            subscriberSlots.clear();
+            removedSubscribers = 0;
+        }
+
+        /**
+         * @returns         Handle of the subscriber at *position*.
+         */
+        SubscriptionHandle HandleAt(size_t position) const
+        {
+            uint32_t slot = subscriberSlots[position];
+            return SubscriptionHandle{slot, slots[slot].generation};
+        }
+
+        /**
+         * @returns         Position of the first (or last) subscribed function, or subscribers.size() if there is none.
+         */
+        size_t FirstPosition() const
+        {
+            size_t i = 0;
+            while (i < subscribers.size() && subscriberSlots[i] == NoSlot)
+            {
+                ++i;
+            }
+            return i;
+        }
+        size_t LastPosition() const
+        {
+            size_t i = subscribers.size();
+            while (i > 0 && subscriberSlots[i - 1] == NoSlot)
+            {
+                --i;
+            }
+            return i > 0 ? i - 1 : subscribers.size();
+        }
+
+        /**
+         * @returns         true if both delegates have equal subscribed functions in the same order.
+         */
+        bool EqualSubscribers(const SimpleDelegateBase &rhs) const
+        {
+            size_t i = 0, j = 0;
+            for (;;)
+            {
+                while (i < subscribers.size() && subscriberSlots[i] == NoSlot)
+                {
+                    ++i;
+                }
+                while (j < rhs.subscribers.size() && rhs.subscriberSlots[j] == NoSlot)
+                {
+                    ++j;
+                }
+                if (i == subscribers.size() || j == rhs.subscribers.size())
+                {
+                    return i == subscribers.size() && j == rhs.subscribers.size();
+                }
+                if (subscribers[i++] != rhs.subscribers[j++])
+                {
+                    return false;
+                }
+            }
+        }
+
+    private:
+        SubscriptionHandle AcquireSlot(uint32_t position)
+        {
+            uint32_t index = freeSlots;
+            if (index == NoSlot)
+            {
+                index = static_cast<uint32_t>(slots.size());
+                slots.push_back(SubscriptionSlot{position, 0});
+            }
+            else
+            {
+                freeSlots = slots[index].position;
+                slots[index].position = position;
+            }
+            return SubscriptionHandle{index, slots[index].generation};
+        }
+
+        void ReleaseSlot(uint32_t index)
+        {
+            slots[index].generation++;
+            slots[index].position = freeSlots;
+            freeSlots = index;
+        }
+
+        void UpdatePositions(size_t from)
+        {
+            for (size_t i = from; i < subscribers.size(); ++i)
+            {
+                if (subscriberSlots[i] != NoSlot)
+                {
+                    slots[subscriberSlots[i]].position = static_cast<uint32_t>(i);
+                }
+            }
+        }
+    };
+
+    template <typename Allocator, typename... Params>
+    class BasicSimpleDelegate : public SimpleDelegateBase<Allocator, void, Params...>
+    {
+    public:
+        using Parent = SimpleDelegateBase<Allocator, void, Params...>;
+        using Parent::subscribers;
+        using typename Parent::FunctionType;
+
+        BasicSimpleDelegate() = default;
+        explicit BasicSimpleDelegate(const Allocator &allocator) : Parent(allocator) {}
+
+        /**
+         * @brief           Invoke all subscribed functions.
+         *
+         * @param  params:  Arguments of each subscribed function.
+         */
+        void operator()(ArgumentType<Params>... params)
+        {
+            for (auto &&i : subscribers)
+            {
+                if (i)
+                {
+                    i.CallShared(params...);
+                }
+            }
+        }
+
+        /**
+         * @brief           Invoke all subscribed functions in parallel on the executor of *policy*.
+         * @note            Subscribers must be safe to call concurrently; the delegate must not be modified until it returns.
+         *
+         * @param  policy:  Executor and grain, see Parallel().
+         * @param  params:  Arguments of each subscribed function.
+         */
+        template <typename Executor>
+        void operator()(ParallelPolicy<Executor> policy, ArgumentType<Params>... params)
+        {
+            policy.executor.ParallelFor(subscribers.size(), policy.grain, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; i++)
+                {
+                    if (subscribers[i])
+                    {
+                        subscribers[i].CallShared(params...);
+                    }
+                }
+            });
+        }
+
+        /**
+         * @brief           Subscribe function to this delegate.
+         *
+         * @param  function:    Function to subscribe.
+         * @returns         Handle that unsubscribes exactly this subscription with Unsubscribe().
+         */
+        SubscriptionHandle Add(const FunctionType &function)
+        {
+            return this->AddSubscriber(function);
+        }
+
+        /**
+         * @brief           Subscribe function to this delegate for the lifetime of the returned connection.
+         *
+         * @param  function:    Function to subscribe.
+         * @returns         Connection unsubscribing the function when destroyed.
+         */
+        ScopedConnection Connect(const FunctionType &function)
+        {
+            return ScopedConnection(*this, this->AddSubscriber(function));
+        }
+
+        /**
+         * @brief           Unsubscribe the subscription of *handle* in O(1).
+         *
+         * @param  handle:  Handle returned on subscription.
+         * @returns         true if the subscription existed.
+         */
+        bool Unsubscribe(SubscriptionHandle handle)
+        {
+            if (!this->ReleaseSubscriber(handle))
+            {
+                return false;
             }
+            if (this->NeedsCompaction())
+            {
+                this->CompactSubscribers();
+            }
+            return true;
+        }
+
+        /**
+         * @brief           Subscribe function to this delegate.
+         *
+         * @param  rhs:     Function to subscribe.
+         * @returns         Reference to the delegate instance.
+         */
+        BasicSimpleDelegate &operator+=(const FunctionType &rhs)
+        {
+            this->AddSubscriber(rhs);
+            return *this;
+        }
+
+        /**
+         * @brief           Unsubscribe choosen function from this delegate.
+         *
+         * @param  rhs:     Function to unsubscribe from this delegate.
+         * @returns         Reference to the delegate instance.
+         */
+        BasicSimpleDelegate &operator-=(const FunctionType &rhs)
+        {
+            this->RemoveSubscribersIf([&](size_t i) { return subscribers[i] == rhs; });
             return *this;
         }
+    };
+
+    /**
+     * @brief  BasicSimpleDelegate using the default allocator.
+     */
+    template <typename... Params>
+    using SimpleDelegate = BasicSimpleDelegate<DefaultAllocator, Params...>;
+
+#if DW_HAS_STD_SPAN
+    /**
+     * @brief  Contiguous view of *T* elements handed to batch subscribers.
+     */
+    template <typename T>
+    using Span = std::span<T>;
+#else
+    /**
+     * @brief  Contiguous view of *T* elements handed to batch subscribers (subset of C++20 std::span).
+     */
+    template <typename T>
+    class Span
+    {
+    public:
+        Span() = default;
+        Span(T *data, size_t size) : pointer(data), count(size) {}
+
+        T *data() const { return pointer; }
+        size_t size() const { return count; }
+        bool empty() const { return count == 0; }
+        T *begin() const { return pointer; }
+        T *end() const { return pointer + count; }
+        T &operator[](size_t index) const { return pointer[index]; }
+
+    private:
+        T *pointer = nullptr;
+        size_t count = 0;
+    };
+#endif
+
+    /**
+     * @brief  Storage type of a saved parameter of type *T* (references are saved as std::reference_wrapper).
+     */
+    template <typename T>
+    struct ParameterColumn
+    {
+        using Type = T;
+        static const T &Load(const T &value) { return value; }
+        static T &&Take(T &value) { return std::move(value); }
+    };
+
+    template <typename T>
+    struct ParameterColumn<T &>
+    {
+        using Type = std::reference_wrapper<T>;
+        static T &Load(const Type &value) { return value.get(); }
+        static T &Take(const Type &value) { return value.get(); }
+    };
+
+    template <typename T>
+    struct ParameterColumn<T &&>
+    {
+        using Type = std::reference_wrapper<T>;
+        static T &&Load(const Type &value) { return std::move(value.get()); }
+        static T &&Take(const Type &value) { return std::move(value.get()); }
+    };
+
+    /**
+     * @brief  One byte boolean, so saved bool parameters get a real contiguous column (std::vector<bool> is packed
+     *         and has no data()).
+     */
+    struct SavedBool
+    {
+        unsigned char value;
+
+        SavedBool(bool value = false) : value(value) {}
+        operator bool() const { return value != 0; }
+    };
+
+    template <>
+    struct ParameterColumn<bool>
+    {
+        using Type = SavedBool;
+        static bool Load(const Type &value) { return value; }
+        static bool Take(const Type &value) { return value; }
+    };
+
+    /**
+     * @brief  Saved parameters packs stored as a structure of arrays: one contiguous column per parameter.
+     * @tparam Allocator    Allocator of the columns.
+     * @tparam Params       Any number of arguments of any type.
+     */
+    template <typename Allocator, typename... Params>
+    class ParameterColumns
+    {
+    public:
+        ParameterColumns() : ParameterColumns(Allocator()) {}
+
+        explicit ParameterColumns(const Allocator &allocator)
+            : columns(AllocatorVector<typename ParameterColumn<Params>::Type, Allocator>(allocator)...)
+        {
+            (void)allocator;
+        }
+
+        size_t Size() const { return size; }
+
+        void Reserve(size_t capacity)
+        {
+            ReserveColumns(capacity, Sequence());
+        }
+
+        void Push(const std::tuple<Params...> &params)
+        {
+            PushColumns(params, Sequence());
+            size++;
+        }
+
+        void Push(std::tuple<Params...> &&params)
+        {
+            PushColumns(std::move(params), Sequence());
+            size++;
+        }
+
+        /**
+         * @returns         Parameters pack saved in *row*.
+         */
+        std::tuple<Params...> Load(size_t row) const
+        {
+            return Load(row, Sequence());
+        }
+
+        /**
+         * @brief           Call the Callable *function* with the parameters pack saved in *row*, without copying it.
+         */
+        template <typename Function>
+        auto Call(const Function &function, size_t row) const -> decltype(function.CallShared(std::declval<ArgumentType<Params>>()...))
+        {
+            return Call(function, row, Sequence());
+        }
+
+        /**
+         * @brief           Call *function* with the parameters pack saved in *row*, moved out of the columns.
+         * @note            Leaves the row moved-from: it must be dropped afterwards.
+         */
+        template <typename Function>
+        auto Consume(const Function &function, size_t row) -> decltype(function(std::declval<Params>()...))
+        {
+            return Consume(function, row, Sequence());
+        }
+
+        /**
+         * @brief           Call *function* once with a span over each whole column.
+         */
+        template <typename Function>
+        void CallBatch(const Function &function) const
+        {
+            CallBatch(function, Sequence());
+        }
+
+        /**
+         * @brief           Move the parameters pack of row *from* into row *to*.
+         */
+        void Move(size_t to, size_t from)
+        {
+            MoveColumns(to, from, Sequence());
+        }
+
+        void RotateLastToFront()
+        {
+            RotateColumns(Sequence());
+        }
+
+        /**
+         * @brief           Reorder the rows so that row *i* becomes row *order[i]* of the old layout.
+         */
+        void Permute(const AllocatorVector<size_t, Allocator> &order)
+        {
+            PermuteColumns(order, Sequence());
+        }
+
+        void Truncate(size_t newSize)
+        {
+            TruncateColumns(newSize, Sequence());
+            size = newSize;
+        }
+
+        void Clear() { Truncate(0); }
+
+        template <typename T, typename ColumnAllocator>
+        static void Permute(std::vector<T, ColumnAllocator> &column, const AllocatorVector<size_t, Allocator> &order)
+        {
+            std::vector<T, ColumnAllocator> permuted(column.get_allocator());
+            permuted.reserve(column.size());
+            for (size_t i : order)
+            {
+                permuted.push_back(std::move(column[i]));
+            }
+            column.swap(permuted);
+        }
+
+    private:
+        using Sequence = std::index_sequence_for<Params...>;
+
+        template <size_t... Indices>
+        std::tuple<Params...> Load(size_t row, std::index_sequence<Indices...>) const
+        {
+            (void)row;
+            return std::tuple<Params...>(ParameterColumn<Params>::Load(std::get<Indices>(columns)[row])...);
+        }
+
+        template <typename Function, size_t... Indices>
+        auto Call(const Function &function, size_t row, std::index_sequence<Indices...>) const
+            -> decltype(function.CallShared(std::declval<ArgumentType<Params>>()...))
+        {
+            (void)row;
+            return function.CallShared(ParameterColumn<Params>::Load(std::get<Indices>(columns)[row])...);
+        }
+
+        template <typename Function, size_t... Indices>
+        auto Consume(const Function &function, size_t row, std::index_sequence<Indices...>)
+            -> decltype(function(std::declval<Params>()...))
+        {
+            (void)row;
+            return function(ParameterColumn<Params>::Take(std::get<Indices>(columns)[row])...);
+        }
+
+        template <typename Function, size_t... Indices>
+        void CallBatch(const Function &function, std::index_sequence<Indices...>) const
+        {
+            function(Span<const typename ParameterColumn<Params>::Type>(std::get<Indices>(columns).data(), size)...);
+        }
+
+        template <size_t... Indices>
+        void ReserveColumns(size_t capacity, std::index_sequence<Indices...>)
+        {
+            (void)capacity;
+            int expand[] = {0, (std::get<Indices>(columns).reserve(capacity), 0)...};
+            (void)expand;
+        }
+
+        template <size_t... Indices>
+        void PushColumns(const std::tuple<Params...> &params, std::index_sequence<Indices...>)
+        {
+            (void)params;
+            int expand[] = {0, (std::get<Indices>(columns).push_back(std::get<Indices>(params)), 0)...};
+            (void)expand;
+        }
+
+        template <size_t... Indices>
+        void PushColumns(std::tuple<Params...> &&params, std::index_sequence<Indices...>)
+        {
+            (void)params;
+            int expand[] = {0, (std::get<Indices>(columns).push_back(Moved<Params>(std::get<Indices>(params))), 0)...};
+            (void)expand;
+        }
+
+        /**
+         * @brief           Saved value *value* as rvalue, or the reference it holds as lvalue.
+         */
+        template <typename T, typename Value>
+        static typename std::conditional<std::is_reference<T>::value, Value &, Value &&>::type Moved(Value &value)
+        {
+            return static_cast<typename std::conditional<std::is_reference<T>::value, Value &, Value &&>::type>(value);
+        }
+
+        template <size_t... Indices>
+        void MoveColumns(size_t to, size_t from, std::index_sequence<Indices...>)
+        {
+            (void)to;
+            (void)from;
+            int expand[] = {0, (std::get<Indices>(columns)[to] = std::move(std::get<Indices>(columns)[from]), 0)...};
+            (void)expand;
+        }
+
+        template <size_t... Indices>
+        void RotateColumns(std::index_sequence<Indices...>)
+        {
+            int expand[] = {0, (std::rotate(std::get<Indices>(columns).begin(), std::get<Indices>(columns).end() - 1, std::get<Indices>(columns).end()), 0)...};
+            (void)expand;
+        }
+
+        template <size_t... Indices>
+        void PermuteColumns(const AllocatorVector<size_t, Allocator> &order, std::index_sequence<Indices...>)
+        {
+            (void)order;
+            int expand[] = {0, (Permute(std::get<Indices>(columns), order), 0)...};
+            (void)expand;
+        }
+
+        template <size_t... Indices>
+        void TruncateColumns(size_t newSize, std::index_sequence<Indices...>)
+        {
+            (void)newSize;
+            int expand[] = {0, (std::get<Indices>(columns).erase(std::get<Indices>(columns).begin() + newSize, std::get<Indices>(columns).end()), 0)...};
+            (void)expand;
+        }
+
+        std::tuple<AllocatorVector<typename ParameterColumn<Params>::Type, Allocator>...> columns;
+        size_t size = 0;
+    };
+
+    /**
+     * @brief  Saved calls of a delegate's subscribers (subscriber + saved parameters pack), stored as a structure of arrays.
+     * @note   The position of the called subscriber, the owning subscription and every parameter live in their own
+     *         contiguous column, so invoking all calls streams through memory linearly and reaches each target with
+     *         one lookup. The delegate keeps the positions up to date when its subscribers move. Calls are identified
+     *         by their row.
+     * @tparam Allocator    Allocator of the columns.
+     * @tparam ReturnType   Return type of the saved functions.
+     * @tparam Params       Any number of arguments of any type.
+     */
+    template <typename Allocator, typename ReturnType, typename... Params>
+    class SavedCalls
+    {
+    public:
+        using FunctionType = Callable<ReturnType, Params...>;
+
+        /**
+         * @brief           Position of the calls whose subscriber was removed.
+         */
+        static constexpr uint32_t NoPosition = UINT32_MAX;
+
+        SavedCalls() : SavedCalls(Allocator()) {}
+
+        explicit SavedCalls(const Allocator &allocator)
+            : positions(allocator), owners(allocator), parameters(allocator)
+        {
+        }
+
+        size_t Size() const { return positions.size(); }
+        bool Empty() const { return positions.empty(); }
+
+        /**
+         * @returns         false if the call of *row* was disabled.
+         */
+        bool IsEnabled(size_t row) const { return positions[row] != NoPosition; }
+
+        SubscriptionHandle Owner(size_t row) const { return owners[row]; }
+
+        /**
+         * @returns         Position of the subscriber called by *row* (*NoPosition* if disabled).
+         */
+        uint32_t Position(size_t row) const { return positions[row]; }
+
+        void SetPosition(size_t row, uint32_t position) { positions[row] = position; }
+
+        /**
+         * @brief           Reserve room for *size* calls in every column.
+         */
+        void Reserve(size_t size)
+        {
+            positions.reserve(size);
+            owners.reserve(size);
+            parameters.Reserve(size);
+        }
+
+        /**
+         * @brief           Append a call of the subscriber at *position* with *params*, owned by the subscription *owner*.
+         */
+        void Push(SubscriptionHandle owner, uint32_t position, const std::tuple<Params...> &params)
+        {
+            grouped = false;
+            positions.push_back(position);
+            owners.push_back(owner);
+            parameters.Push(params);
+        }
+
+        void Push(SubscriptionHandle owner, uint32_t position, std::tuple<Params...> &&params)
+        {
+            grouped = false;
+            positions.push_back(position);
+            owners.push_back(owner);
+            parameters.Push(std::move(params));
+        }
+
+        /**
+         * @brief           Append a copy of the call *row* of *other*, calling the subscriber at *position* and owned by *owner*.
+         */
+        void PushCopy(const SavedCalls &other, size_t row, SubscriptionHandle owner, uint32_t position)
+        {
+            Push(owner, position, other.parameters.Load(row));
+        }
+
+        /**
+         * @brief           Move the last call to the front, shifting every other call by one row.
+         */
+        void RotateLastToFront()
+        {
+            grouped = false;
+            std::rotate(positions.begin(), positions.end() - 1, positions.end());
+            std::rotate(owners.begin(), owners.end() - 1, owners.end());
+            parameters.RotateLastToFront();
+        }
+
+        /**
+         * @brief           Keep the call *row* but stop invoking it.
+         */
+        void Disable(size_t row) { positions[row] = NoPosition; }
+
+        /**
+         * @brief           Remove every call for which *predicate(row)* returns true, keeping the order of the remaining ones.
+         */
+        template <typename Predicate>
+        void RemoveIf(Predicate predicate)
+        {
+            size_t kept = 0;
+            for (size_t i = 0; i < positions.size(); ++i)
+            {
+                if (predicate(i))
+                {
+                    continue;
+                }
+                if (kept != i)
+                {
+                    positions[kept] = positions[i];
+                    owners[kept] = owners[i];
+                    parameters.Move(kept, i);
+                }
+                kept++;
+            }
+            Truncate(kept);
+        }
+
+        void Clear() { Truncate(0); }
+
+        /**
+         * @brief           Reorder the calls so that calls sharing a target (see Callable::SameTarget()) are contiguous,
+         *                  *target(row)* being the function called by *row*.
+         * @note            Stable: calls of the same target keep their relative order, targets are ordered by their
+         *                  first call. Runs in linear time, and only once until calls are added or moved: removing or
+         *                  disabling calls keeps them grouped. The scratch buffers use the allocator of the columns.
+         * @returns         false if the calls were already grouped and nothing was moved.
+         */
+        template <typename Target>
+        bool GroupByTarget(const Target &target)
+        {
+            if (grouped)
+            {
+                return false;
+            }
+            grouped = true;
+
+            struct TargetHash
+            {
+                size_t operator()(const FunctionType *function) const { return function->TargetHash(); }
+            };
+            struct SameTarget
+            {
+                bool operator()(const FunctionType *lhs, const FunctionType *rhs) const { return lhs->SameTarget(*rhs); }
+            };
+
+            using Ids = std::unordered_map<const FunctionType *, uint32_t, TargetHash, SameTarget,
+                                           typename std::allocator_traits<Allocator>::template rebind_alloc<std::pair<const FunctionType *const, uint32_t>>>;
+
+            size_t size = positions.size();
+            AllocatorVector<uint32_t, Allocator> groups(size, 0, positions.get_allocator());
+            AllocatorVector<size_t, Allocator> offsets(positions.get_allocator());
+            Ids ids(0, TargetHash(), SameTarget(), positions.get_allocator());
+            size_t runs = 0;
+
+            for (size_t i = 0; i < size; ++i)
+            {
+                if (i > 0 && target(i).SameTarget(target(i - 1)))
+                {
+                    groups[i] = groups[i - 1];
+                    offsets[groups[i]]++;
+                    continue;
+                }
+
+                runs++;
+                auto found = ids.find(&target(i));
+                if (found == ids.end())
+                {
+                    found = ids.emplace(&target(i), static_cast<uint32_t>(offsets.size())).first;
+                    offsets.push_back(0);
+                }
+                groups[i] = found->second;
+                offsets[groups[i]]++;
+            }
+
+            if (runs == offsets.size())
+            {
+                return false;
+            }
+
+            size_t start = 0;
+            for (auto &offset : offsets)
+            {
+                size_t count = offset;
+                offset = start;
+                start += count;
+            }
+
+            AllocatorVector<size_t, Allocator> order(size, 0, positions.get_allocator());
+            for (size_t i = 0; i < size; ++i)
+            {
+                order[offsets[groups[i]]++] = i;
+            }
+
+            ParameterColumns<Allocator, Params...>::Permute(positions, order);
+            ParameterColumns<Allocator, Params...>::Permute(owners, order);
+            parameters.Permute(order);
+            return true;
+        }
+
+        /**
+         * @brief           Call *function*, the subscriber of *row*, with the saved parameters of *row*.
+         */
+        ReturnType Invoke(const FunctionType &function, size_t row) const
+        {
+            return parameters.Call(function, row);
+        }
+
+        /**
+         * @brief           Call *function*, the subscriber of *row*, moving the saved parameters of *row* into the call.
+         *                  The row must be dropped afterwards.
+         */
+        ReturnType Consume(const FunctionType &function, size_t row)
+        {
+            return parameters.Consume(function, row);
+        }
+
+    private:
+        void Truncate(size_t size)
+        {
+            positions.erase(positions.begin() + size, positions.end());
+            owners.erase(owners.begin() + size, owners.end());
+            parameters.Truncate(size);
+        }
+
+        AllocatorVector<uint32_t, Allocator> positions;
+        AllocatorVector<SubscriptionHandle, Allocator> owners;
+        ParameterColumns<Allocator, Params...> parameters;
+
+        /**
+         * @brief           true if the calls are known to be grouped by target (see GroupByTarget()).
+         */
+        bool grouped = true;
+    };
+
+    /**
+     * @brief  Result combiners of RetDelegate, RetMemberDelegate and RetBoundDelegate.
+     * @note   A combiner receives the result of each called subscriber through *operator()(T value)*, which returns
+     *         false to stop calling the remaining subscribers, and exposes the combined value as *Result()*
+     *         of type *ResultType*. Any type following this protocol can be passed to the delegates.
+     */
+
+    /**
+     * @brief  Sum of all results (*+=*). Default combiner of the delegates.
+     */
+    template <typename T>
+    class SumResults
+    {
+    public:
+        using ResultType = T;
+
+        bool operator()(T value)
+        {
+            sum += std::move(value);
+            return true;
+        }
+
+        T Result() { return std::move(sum); }
+
+    private:
+        T sum = T();
+    };
+
+    /**
+     * @brief  Result of the first called subscriber; the other ones are not called.
+     */
+    template <typename T>
+    class FirstResult
+    {
+    public:
+        using ResultType = T;
+
+        bool operator()(T value)
+        {
+            first = std::move(value);
+            return false;
+        }
+
+        T Result() { return std::move(first); }
+
+    private:
+        T first = T();
+    };
+
+    /**
+     * @brief  Result of the last called subscriber.
+     */
+    template <typename T>
+    class LastResult
+    {
+    public:
+        using ResultType = T;
+
+        bool operator()(T value)
+        {
+            last = std::move(value);
+            return true;
+        }
+
+        T Result() { return std::move(last); }
+
+    private:
+        T last = T();
+    };
+
+    /**
+     * @brief  Smallest result (compared with *<*), *T()* if no subscriber was called.
+     */
+    template <typename T>
+    class MinResult
+    {
+    public:
+        using ResultType = T;
+
+        bool operator()(T value)
+        {
+            if (empty || value < min)
+            {
+                min = std::move(value);
+                empty = false;
+            }
+            return true;
+        }
+
+        T Result() { return std::move(min); }
+
+    private:
+        T min = T();
+        bool empty = true;
+    };
+
+    /**
+     * @brief  Largest result (compared with *<*), *T()* if no subscriber was called.
+     */
+    template <typename T>
+    class MaxResult
+    {
+    public:
+        using ResultType = T;
+
+        bool operator()(T value)
+        {
+            if (empty || max < value)
+            {
+                max = std::move(value);
+                empty = false;
+            }
+            return true;
+        }
+
+        T Result() { return std::move(max); }
+
+    private:
+        T max = T();
+        bool empty = true;
+    };
+
+    /**
+     * @brief  true if any result is true. Stops at the first true result.
+     */
+    class AnyResult
+    {
+    public:
+        using ResultType = bool;
+
+        bool operator()(bool value)
+        {
+            any = value;
+            return !value;
+        }
+
+        bool Result() const { return any; }
+
+    private:
+        bool any = false;
+    };
+
+    /**
+     * @brief  true if all results are true (or no subscriber was called). Stops at the first false result.
+     */
+    class AllResults
+    {
+    public:
+        using ResultType = bool;
+
+        bool operator()(bool value)
+        {
+            all = value;
+            return value;
+        }
+
+        bool Result() const { return all; }
+
+    private:
+        bool all = true;
+    };
+
+    /**
+     * @brief  true if a result satisfies *predicate*. Stops at the first one that does.
+     */
+    template <typename T, typename Predicate>
+    class UntilResult
+    {
+    public:
+        using ResultType = bool;
+
+        explicit UntilResult(Predicate predicate) : predicate(std::move(predicate)) {}
+
+        bool operator()(const T &value)
+        {
+            found = static_cast<bool>(predicate(value));
+            return !found;
+        }
+
+        bool Result() const { return found; }
+
+    private:
+        Predicate predicate;
+        bool found = false;
+    };
+
+    /**
+     * @brief  Writes the results into a caller-provided output span. Stops once the span is full.
+     * @note   *Result()* is the count of written results.
+     */
+    template <typename T>
+    class CollectResults
+    {
+    public:
+        using ResultType = size_t;
+
+        explicit CollectResults(Span<T> output) : output(output) {}
+
+        bool operator()(T value)
+        {
+            output[count++] = std::move(value);
+            return count < output.size();
+        }
+
+        size_t Result() const { return count; }
+
+    private:
+        Span<T> output;
+        size_t count = 0;
+    };
+
+    /**
+     * @brief  Custom fold of the results: *accumulator = fold(accumulator, result)*, see Fold().
+     */
+    template <typename T, typename Function>
+    class FoldResults
+    {
+    public:
+        using ResultType = T;
+
+        FoldResults(T initial, Function fold) : accumulator(std::move(initial)), fold(std::move(fold)) {}
+
+        template <typename Value>
+        bool operator()(Value &&value)
+        {
+            accumulator = fold(std::move(accumulator), std::forward<Value>(value));
+            return true;
+        }
+
+        T Result() { return std::move(accumulator); }
+
+    private:
+        T accumulator;
+        Function fold;
+    };
+
+    /**
+     * @brief           Make a combiner folding the results with *fold*, starting from *initial*.
+     */
+    template <typename T, typename Function>
+    FoldResults<T, Function> Fold(T initial, Function fold)
+    {
+        return FoldResults<T, Function>(std::move(initial), std::move(fold));
+    }
+
+    /**
+     * @brief  Enables a combiner overload when *Combiner* follows the combiner protocol for results of type *T*.
+     */
+    template <typename Combiner, typename T, typename = void>
+    struct IsCombiner : std::false_type
+    {
+    };
+
+    template <typename Combiner, typename T>
+    struct IsCombiner<Combiner, T, decltype(void(std::declval<typename Combiner::ResultType>()), void(static_cast<bool>(std::declval<Combiner &>()(std::declval<T>()))))>
+        : std::true_type
+    {
+    };
+
+    /**
+     * @brief  Result part of AsyncInvocation: sum (*+=*) of the results of the asynchronous calls, in subscription order.
+     */
+    template <typename ReturnType>
+    class AsyncResult
+    {
+    public:
+        /**
+         * @returns         Sum of the results, valid once the invocation completed (after Wait() or in the continuation).
+         */
+        const ReturnType &Result() const { return result; }
+
+    protected:
+        /**
+         * @brief           Make room for the results of *count* calls, keeping the capacity of previous invocations.
+         */
+        void ResetResult(size_t count)
+        {
+            result = ReturnType();
+            results.clear();
+            results.resize(count);
+        }
+
+        /**
+         * @brief           Store the result of call *index*. Calls complete in any order, each writes its own slot.
+         */
+        void SetResult(size_t index, ReturnType value) { results[index] = std::move(value); }
+
+        /**
+         * @brief           Sum the results of the calls *called(index)* made, left to right, once all completed.
+         */
+        template <typename Called>
+        void ReduceResults(const Called &called)
+        {
+            for (size_t i = 0; i < results.size(); i++)
+            {
+                if (called(i))
+                {
+                    result += ParameterColumn<ReturnType>::Take(results[i]);
+                }
+            }
+        }
+
+    private:
+        ReturnType result = ReturnType();
+
+        /**
+         * @brief           Result slot of each call, stored like a saved parameter so that bool results are not
+         *                  bit-packed and concurrent calls never write to the same byte.
+         */
+        std::vector<typename ParameterColumn<ReturnType>::Type> results;
+    };
+
+    template <>
+    class AsyncResult<void>
+    {
+    protected:
+        void ResetResult(size_t) {}
+
+        template <typename Called>
+        void ReduceResults(const Called &)
+        {
+        }
+    };
+
+    /**
+     * @brief  Completion object of an asynchronous invocation (see Delegate::InvokeAsync()), provided by the caller.
+     * @note   Holds the arguments and the count of pending calls in place, so an invocation allocates nothing besides
+     *         what the executor needs to queue its tasks, and one result slot per subscriber if *ReturnType* is not void
+     *         (kept for the next invocations). Reusable once the previous invocation completed.
+     *         Reference parameters are saved as references: the referenced objects must outlive the invocation.
+     * @tparam ReturnType   Return type of the subscribed functions.
+     * @tparam Params       Any number of arguments of any type.
+     */
+    template <typename ReturnType, typename... Params>
+    class AsyncInvocation : public AsyncResult<ReturnType>
+    {
+    public:
+        using FunctionType = Callable<ReturnType, Params...>;
+        using ContinuationType = Callable<void, AsyncInvocation &>;
+
+        AsyncInvocation() = default;
+        AsyncInvocation(const AsyncInvocation &) = delete;
+        AsyncInvocation &operator=(const AsyncInvocation &) = delete;
+
+        /**
+         * @brief           Waits for the pending invocation: its tasks refer to this object.
+         */
+        ~AsyncInvocation() { Wait(); }
+
+        /**
+         * @returns         true if no invocation is pending.
+         */
+        bool IsDone() const
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return state == State::Done;
+        }
+
+        /**
+         * @brief           Block until every call of the pending invocation and its continuation completed.
+         * @note            Waiting from a task of the same executor can deadlock it if every thread ends up waiting.
+         */
+        void Wait() const
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            finished.wait(lock, [this] { return state == State::Done; });
+        }
+
+        /**
+         * @brief           Call *continuation* once every call of the pending invocation completed, on the thread
+         *                  completing the last one. Called right away if the invocation already completed.
+         * @note            Replaces the continuation previously set for the same invocation.
+         */
+        void Then(const ContinuationType &continuation)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (state == State::Running)
+                {
+                    next = continuation;
+                    return;
+                }
+            }
+            continuation(*this);
+        }
+
+        /**
+         * @brief           Post a task calling each function of *functions* with *params* on *executor*.
+         * @note            Waits for the previous invocation first. *functions* must not be modified until it completes.
+         *
+         * @param  executor:    Executor providing *Post(Callable<void>)* (see SequentialExecutor).
+         */
+        template <typename Executor, typename Functions>
+        void Start(Executor &executor, const Functions &functions, ArgumentType<Params>... params)
+        {
+            Wait();
+            this->ResetResult(functions.size());
+            subscribers = functions.data();
+            ::new (static_cast<void *>(&arguments)) Arguments(params...);
+
+            size_t count = 0;
+            for (auto &&i : functions)
+            {
+                count += i ? 1 : 0;
+            }
+            // One extra count held while posting, so the invocation cannot complete before every task is queued.
+            pending.store(count + 1, std::memory_order_relaxed);
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                state = State::Running;
+                next.Reset();
+            }
+
+            for (size_t i = 0; i < functions.size(); i++)
+            {
+                if (functions[i])
+                {
+                    executor.Post(Callable<void>([this, i] { Run(i); }));
+                }
+            }
+            Release();
+        }
+
+    private:
+        using Arguments = std::tuple<typename ParameterColumn<Params>::Type...>;
+        using Sequence = std::index_sequence_for<Params...>;
+
+        enum class State
+        {
+            Running,
+            Completing,
+            Done
+        };
+
+        void Run(size_t index)
+        {
+            Call(index, Sequence(), std::is_void<ReturnType>());
+            Release();
+        }
+
+        template <size_t... Indices>
+        void Call(size_t index, std::index_sequence<Indices...>, std::true_type)
+        {
+            subscribers[index].CallShared(ParameterColumn<Params>::Load(std::get<Indices>(Stored()))...);
+        }
+
+        template <size_t... Indices>
+        void Call(size_t index, std::index_sequence<Indices...>, std::false_type)
+        {
+            this->SetResult(index, subscribers[index].CallShared(ParameterColumn<Params>::Load(std::get<Indices>(Stored()))...));
+        }
+
+        void Release()
+        {
+            if (pending.fetch_sub(1, std::memory_order_acq_rel) != 1)
+            {
+                return;
+            }
+
+            Stored().~Arguments();
+            this->ReduceResults([this](size_t index) { return static_cast<bool>(subscribers[index]); });
+            ContinuationType continuation;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                state = State::Completing;
+                continuation = std::move(next);
+            }
+            if (continuation)
+            {
+                continuation(*this);
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            state = State::Done;
+            finished.notify_all();
+        }
+
+        Arguments &Stored() { return *reinterpret_cast<Arguments *>(&arguments); }
+
+        const FunctionType *subscribers = nullptr;
+        typename std::aligned_storage<sizeof(Arguments), alignof(Arguments)>::type arguments;
+        std::atomic<size_t> pending{0};
+        ContinuationType next;
+
+        mutable std::mutex mutex;
+        mutable std::condition_variable finished;
+        State state = State::Done;
+    };
+
+    template <typename Allocator, typename ReturnType, typename... Params>
+    class DelegateBase : public SimpleDelegateBase<Allocator, ReturnType, Params...>
+    {
+    protected:
+        using Parent = SimpleDelegateBase<Allocator, ReturnType, Params...>;
+        using Parent::slots;
+        using Parent::subscribers;
+        using Parent::subscriberSlots;
+        using typename Parent::FunctionType;
+
+        static constexpr uint32_t NoRow = UINT32_MAX;
+
+        /**
+         * @brief           Calls saved when each function is subscribed to this delegate using Subscribe() method.
+         * @note            Each call stores the position of its subscriber rather than a copy of it (see SavedFunction()),
+         *                  so a subscription has a single target whether it is called by operator() or Invoke(). The
+         *                  positions are updated whenever the subscribers move. Calls of unsubscribed functions are
+         *                  disabled and dropped on the next compaction.
+         */
+        SavedCalls<Allocator, ReturnType, Params...> parameters;
+
+        /**
+         * @brief           Row in ***parameters*** of the call saved for each subscription slot (*NoRow* if none).
+         */
+        AllocatorVector<uint32_t, Allocator> parameterRows;
+
+    public:
+        /**
+         * @brief           Type of batch subscribers: called once with a span over every saved parameter column.
+         */
+        using BatchFunctionType = Callable<void, Span<const typename ParameterColumn<Params>::Type>...>;
+
+    protected:
+        struct BatchSubscriber
+        {
+            BatchFunctionType function;
+            uint32_t generation;
+            ParameterColumns<Allocator, Params...> parameters;
+        };
+
+        /**
+         * @brief           Subscribers added with SubscribeBatch(). Unsubscribed ones are left empty and reused.
+         */
+        AllocatorVector<BatchSubscriber, Allocator> batchSubscribers;
+
+        DelegateBase() : DelegateBase(Allocator()) {}
+
+        explicit DelegateBase(const Allocator &allocator)
+            : Parent(allocator), parameters(allocator), parameterRows(allocator), batchSubscribers(allocator)
+        {
+        }
+
+    public:
+        /**
+         * @note            May contain empty entries of unsubscribed functions until the next compaction.
+         */
+        const AllocatorVector<FunctionType, Allocator> &GetSubscribers() const { return this->subscribers; }
+
+        /**
+         * @brief           Subscribe all functions (subscribers) from other delegate to this delegate.
+         *
+         * @param  other:   Other delegate reference.
+         */
+        void Combine(const DelegateBase &other)
+        {
+            std::vector<SubscriptionHandle> copies(other.slots.size());
+            size_t count = other.subscribers.size();
+
+            for (size_t i = 0; i < count; i++)
+            {
+                if (other.subscriberSlots[i] != Parent::NoSlot)
+                {
+                    copies[other.subscriberSlots[i]] = this->AddSubscriber(other.subscribers[i]);
+                }
+            }
+
+            count = other.parameters.Size();
+            for (size_t i = 0; i < count; i++)
+            {
+                if (other.IsSubscribed(other.parameters.Owner(i)))
+                {
+                    SubscriptionHandle copy = copies[other.parameters.Owner(i).index];
+                    SetParameterRow(copy, parameters.Size());
+                    parameters.PushCopy(other.parameters, i, copy, slots[copy.index].position);
+                }
+            }
+
+            for (auto &batch : other.batchSubscribers)
+            {
+                if (batch.function)
+                {
+                    BatchSubscriber &copy = batchSubscribers[SubscribeBatch(batch.function).index];
+                    copy.parameters = batch.parameters;
+                }
+            }
+        }
+
+        /**
+         * @brief           Subscribe a function called once per Invoke() with all of its saved parameters packs,
+         *                  as one span per parameter (column). Lets the function process the packs as a batch.
+         * @note            Batch subscribers are only called by Invoke(), after the functions subscribed with Subscribe().
+         *                  Saved parameters packs are kept until ClearBatches() or Clear() is called.
+         * @param  function:    Batch function to subscribe.
+         * @returns         Handle of the batch subscriber, used with Append() and UnsubscribeBatch().
+         */
+        SubscriptionHandle SubscribeBatch(const BatchFunctionType &function)
+        {
+            size_t index = 0;
+            while (index < batchSubscribers.size() && batchSubscribers[index].function)
+            {
+                index++;
+            }
+            if (index == batchSubscribers.size())
+            {
+                batchSubscribers.push_back(BatchSubscriber{BatchFunctionType(), 0, ParameterColumns<Allocator, Params...>(this->GetAllocator())});
+            }
+
+            batchSubscribers[index].function = function;
+            return SubscriptionHandle{static_cast<uint32_t>(index), batchSubscribers[index].generation};
+        }
+
+        /**
+         * @brief           Subscribe a batch function (see SubscribeBatch()) and save multiple parameters packs for it.
+         * @param  function:    Batch function to subscribe.
+         * @param  params:      Multiple parameters packs for the batch function.
+         * @returns         Handle of the batch subscriber.
+         */
+        SubscriptionHandle SubscribeBatch(const BatchFunctionType &function, const std::vector<std::tuple<Params...>> &params)
+        {
+            SubscriptionHandle handle = SubscribeBatch(function);
+            ParameterColumns<Allocator, Params...> &columns = batchSubscribers[handle.index].parameters;
+            columns.Reserve(columns.Size() + params.size());
+            for (auto &&p : params)
+            {
+                columns.Push(p);
+            }
+            return handle;
+        }
+
+        /**
+         * @brief           Save a parameters pack for the batch subscriber of *batch*.
+         * @param  batch:   Handle returned by SubscribeBatch().
+         * @param  params:  Parameters pack to append to its batch.
+         * @returns         false if *batch* is not subscribed.
+         */
+        bool Append(SubscriptionHandle batch, Params... params)
+        {
+            if (!IsBatchSubscribed(batch))
+            {
+                return false;
+            }
+            batchSubscribers[batch.index].parameters.Push(std::tuple<Params...>(std::forward<Params>(params)...));
+            return true;
+        }
+
+        /**
+         * @returns         true if the batch subscriber of *batch* was not unsubscribed yet.
+         */
+        bool IsBatchSubscribed(SubscriptionHandle batch) const
+        {
+            return batch.index < batchSubscribers.size() &&
+                   batchSubscribers[batch.index].generation == batch.generation &&
+                   batchSubscribers[batch.index].function;
+        }
+
+        /**
+         * @brief           Unsubscribe the batch subscriber of *batch* and drop its saved parameters packs.
+         * @returns         false if *batch* is not subscribed.
+         */
+        bool UnsubscribeBatch(SubscriptionHandle batch)
+        {
+            if (!IsBatchSubscribed(batch))
+            {
+                return false;
+            }
+            BatchSubscriber &subscriber = batchSubscribers[batch.index];
+            subscriber.function.Reset();
+            subscriber.parameters.Clear();
+            subscriber.generation++;
+            return true;
+        }
+
+        /**
+         * @brief           Drop the saved parameters packs of all batch subscribers, keeping them subscribed.
+         */
+        void ClearBatches()
+        {
+            for (auto &batch : batchSubscribers)
+            {
+                batch.parameters.Clear();
+            }
+        }
+
+        /**
+         * @brief           Subscribes single function and saves single parameters pack.
+         * @note            Values are moved into the saved pack: pass rvalues (e.g. std::move()) to save them without a copy.
+         *                  Move-only types can be saved; a function taking one by value can only be called by
+         *                  InvokeAndClear(), which moves the saved parameter into it (see Callable::CallShared()).
+         * @param  function:    Function to subscribe.
+         * @param  params:      Parameters pack for the function to subscribe.
+         * @retval          Handle that unsubscribes exactly this subscription with Unsubscribe().
+         */
+        SubscriptionHandle Subscribe(const FunctionType &function, Params... params)
+        {
+            SubscriptionHandle handle = this->AddSubscriber(function);
+            AttachParameters(handle, std::tuple<Params...>(std::forward<Params>(params)...));
+            return handle;
+        }
+
+        /**
+         * @brief           Subscribes multiple functions and saves single parameters pack.
+         * @note
+         * @param  functions:   Multiple functions to subscribe.
+         * @param  params:      Parameters pack for the functions to subscribe.
+         * @retval None
+         */
+        void Subscribe(const std::initializer_list<FunctionType> &functions, Params... params)
+        {
+            for (auto &&d : functions)
+            {
+                AttachParameters(this->AddSubscriber(d), std::tuple<Params...>(params...));
+            }
+        }
+
+        /**
+         * @brief           Subscribes single function and save multiple parameters packs.
+         * @note
+         * @param  function:    Function to subscribe.
+         * @param  params:      Multiple parameter packs for the function to subscribe.
+         * @retval None
+         */
+        void Subscribe(const FunctionType &function, std::vector<std::tuple<Params...>> params)
+        {
+            parameters.Reserve(parameters.Size() + params.size());
+            for (size_t i = 0; i < params.size(); i++)
+            {
+                AttachParameters(this->AddSubscriber(function), std::move(params[i]));
+            }
+        }
+
+        /**
+         * @brief           Subscribe function to this delegate.
+         *
+         * @param  function:    Function to subscribe.
+         * @returns         Handle that unsubscribes exactly this subscription with Unsubscribe().
+         */
+        SubscriptionHandle Add(const FunctionType &function)
+        {
+            return this->AddSubscriber(function);
+        }
+
+        /**
+         * @brief           Subscribe function to this delegate for the lifetime of the returned connection.
+         *
+         * @param  function:    Function to subscribe.
+         * @returns         Connection unsubscribing the function when destroyed.
+         */
+        ScopedConnection Connect(const FunctionType &function)
+        {
+            return ScopedConnection(*this, this->AddSubscriber(function));
+        }
+
+        /**
+         * @brief           Unsubscribe the subscription of *handle* in O(1), along with its saved parameters.
+         *
+         * @param  handle:  Handle returned on subscription.
+         * @returns         true if the subscription existed.
+         */
+        bool Unsubscribe(SubscriptionHandle handle)
+        {
+            if (!this->ReleaseSubscriber(handle))
+            {
+                return false;
+            }
+            uint32_t row = handle.index < parameterRows.size() ? parameterRows[handle.index] : NoRow;
+            if (row != NoRow && parameters.Owner(row) == handle)
+            {
+                parameters.Disable(row);
+            }
+            if (this->NeedsCompaction())
+            {
+                Compact();
+            }
+            return true;
+        }
+
+        /**
+         * @brief           Call all subscribed functions of this delegate that have parameters saved on subscription.
+         */
+        void Invoke()
+        {
+            size_t count = parameters.Size();
+            for (size_t i = 0; i < count; i++)
+            {
+                if (const FunctionType *function = SavedFunction(i))
+                {
+                    parameters.Invoke(*function, i);
+                }
+            }
+            InvokeBatches();
+        }
+
+        /**
+         * @brief           Call the functions that have parameters saved on subscription once, moving the saved parameters
+         *                  into the calls, then unsubscribe them. Call the batch subscribers, then drop their packs.
+         * @note            One-shot counterpart of Invoke() for deferred commands: a function taking a parameter by value
+         *                  receives the saved one moved, without a copy, so move-only parameters are supported. Only
+         *                  this call moves saved parameters: operator() and Invoke() share them, so a function taking a
+         *                  non-copyable parameter by value must only be called here. The storage of the calls is kept
+         *                  for the next ones. Calls saved by the invoked functions are kept for the next invocation.
+         */
+        void InvokeAndClear()
+        {
+            size_t count = parameters.Size();
+            for (size_t i = 0; i < count; i++)
+            {
+                FunctionType function = TakeSavedFunction(i);
+                if (function)
+                {
+                    parameters.Consume(function, i);
+                }
+            }
+            InvokeBatches();
+            ClearBatches();
+            ReleaseSavedCalls(count);
+        }
+
+        /**
+         * @brief           Call all saved calls (see Invoke()) in parallel on *executor*, then the batch subscribers.
+         * @note            Subscribers must be safe to call concurrently; the delegate must not be modified until it returns.
+         *
+         * @param  executor:    Executor providing ParallelFor() (see SequentialExecutor).
+         * @param  grain:       Count of saved calls per task, 0 lets the executor choose.
+         */
+        template <typename Executor>
+        void InvokeParallel(Executor &executor, size_t grain = 0)
+        {
+            executor.ParallelFor(parameters.Size(), grain, [this](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; i++)
+                {
+                    if (const FunctionType *function = SavedFunction(i))
+                    {
+                        parameters.Invoke(*function, i);
+                    }
+                }
+            });
+            executor.ParallelFor(batchSubscribers.size(), 1, [this](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; i++)
+                {
+                    if (batchSubscribers[i].function && batchSubscribers[i].parameters.Size())
+                    {
+                        batchSubscribers[i].parameters.CallBatch(batchSubscribers[i].function);
+                    }
+                }
+            });
+        }
+
+        /**
+         * @brief           Reorder the saved calls so that calls of the same function run back to back.
+         * @note            Calls of each function keep their relative order; functions run in the order of their first
+         *                  saved call. Calls stay grouped for the following invocations until new calls are saved,
+         *                  and grouping them again until then costs nothing.
+         */
+        void GroupSavedCalls()
+        {
+            FunctionType unsubscribed;
+            if (parameters.GroupByTarget([&](size_t row) -> const FunctionType & {
+                    const FunctionType *function = SavedFunction(row);
+                    return function ? *function : unsubscribed;
+                }))
+            {
+                UpdateParameterRows();
+            }
+        }
+
+        /**
+         * @brief           Group the saved calls by function (see GroupSavedCalls()) and call them.
+         * @note            Worth it for large lists of interleaved calls of a few functions: each function is called
+         *                  over a contiguous run, keeping the branch predictor and instruction cache warm.
+         */
+        void InvokeGrouped()
+        {
+            GroupSavedCalls();
+            Invoke();
+        }
+
+        /**
+         * @brief           Remove *count* functions from the back or front.
+         * @note
+         * @param  count:       Count of functions to remove.
+         * @param  fromBack:    If *true* - removing will be performed from back of the subscribers vector. From front otherwise.
+         * @retval None
+         */
+        void Remove(int count = 1, bool fromBack = true)
+        {
+            size_t adjustedCount = count > 0 ? static_cast<size_t>(count) : 0;
+            adjustedCount = adjustedCount < this->Count() ? adjustedCount : this->Count();
+
+            size_t keep = this->Count() - adjustedCount;
+            size_t seen = 0;
+
+            this->RemoveSubscribersIf([&](size_t) { return fromBack ? seen++ >= keep : seen++ < adjustedCount; });
+            PurgeParameters();
+        }
+
+        /**
+         * @brief           Remove all subscribers of this delegate equal to the ***subscriber*** parameter, along with their saved parameters.
+         * @note
+         * @param  subscriber: Function that must be removed from the delegate.
+         */
+        void Remove(const FunctionType &subscriber)
+        {
+            this->RemoveSubscribersIf([&](size_t i) { return subscribers[i] == subscriber; });
+            PurgeParameters();
+        }
+
+        /**
+         * @brief           Remove all subscribers of this delegate appearing in the ***subscribers*** parameter, along with their saved parameters.
+         * @note
+         * @param  subscribers: *std*::vector of functions that must be removed from the delegate.
+         */
+        void Remove(const std::vector<FunctionType> &subscribers)
+        {
+            this->RemoveSubscribersIf([&](size_t i) {
+                return std::find(subscribers.begin(), subscribers.end(), this->subscribers[i]) != subscribers.end();
+            });
+            PurgeParameters();
+        }
+
+        /**
+         * @brief           Remove all subscribed functions from this delegate.
+         * @returns *None*
+         */
+        void Clear()
+        {
+            this->ClearSubscribers();
+            this->parameters.Clear();
+            this->parameterRows.clear();
+            for (auto &batch : batchSubscribers)
+            {
+                if (batch.function)
+                {
+                    batch.function.Reset();
+                    batch.parameters.Clear();
+                    batch.generation++;
+                }
+            }
+        }
+
+        /**
+         * @brief           Subscribe function to this delegate.
+         *
+         * @param  rhs:     Function to subscribe.
+         * @returns         Reference to the delegate instance.
+         */
+        DelegateBase &operator+=(const FunctionType &rhs)
+        {
+            this->AddSubscriber(rhs);
+            return *this;
+        }
+
+        DelegateBase &operator+=(const std::initializer_list<FunctionType> &rhs)
+        {
+            for (auto &&x : rhs)
+            {
+                this->AddSubscriber(x);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief           Unsubscribe choosen function from this delegate.
+         *
+         * @param  rhs:     Function to unsubscribe from this delegate.
+         * @returns         Reference to the delegate instance.
+         */
+        DelegateBase &operator-=(const FunctionType &rhs)
+        {
+            Remove(rhs);
+            return *this;
+        }
+
+        DelegateBase &operator-=(const std::initializer_list<FunctionType> &rhs)
+        {
+            this->RemoveSubscribersIf([&](size_t i) {
+                return std::find(rhs.begin(), rhs.end(), subscribers[i]) != rhs.end();
+            });
+            PurgeParameters();
+            return *this;
+        }
+
+        DelegateBase &operator++()
+        {
+            size_t position = this->FirstPosition();
+            if (position == subscribers.size())
+            {
+                return *this;
+            }
+
+            FunctionType newDel = subscribers[position];
+            SubscriptionHandle original = this->HandleAt(position);
+            AttachParametersOf(original, this->InsertSubscriber(0, newDel), true);
+            UpdateParameterRows();
+
+            return *this;
+        }
+
+        DelegateBase &operator++(int)
+        {
+            size_t position = this->LastPosition();
+            if (position == subscribers.size())
+            {
+                return *this;
+            }
+
+            FunctionType newDel = subscribers[position];
+            SubscriptionHandle original = this->HandleAt(position);
+            AttachParametersOf(original, this->AddSubscriber(newDel), false);
+
+            return *this;
+        }
+
+        DelegateBase &operator--()
+        {
+            size_t position = this->FirstPosition();
+            if (position != subscribers.size())
+            {
+                Unsubscribe(this->HandleAt(position));
+            }
+            return *this;
+        }
+
+        DelegateBase &operator--(int)
+        {
+            size_t position = this->LastPosition();
+            if (position != subscribers.size())
+            {
+                Unsubscribe(this->HandleAt(position));
+            }
+            return *this;
+        }
+
+        /**
+         * @brief           Signature of comparable delegates must match exactly.
+         * @param  rhs:     Other delegate.
+         * @returns         true if count of subscribers of this delegate is less than other's.
+         */
+        bool operator<(const DelegateBase &rhs)
+        {
+            return this->Count() < rhs.Count();
+        }
+
+        /**
+         * @brief           Signature of comparable delegates must match exactly.
+         * @param  rhs:     Other delegate.
+         * @returns         true if count of subscribers of this delegate is less or equals to other's.
+         */
+        bool operator<=(const DelegateBase &rhs)
+        {
+            return this->Count() <= rhs.Count();
+        }
+
+        /**
+         * @brief           Signature of comparable delegates must match exactly.
+         * @param  rhs:     Other delegate.
+         * @returns         true if count of subscribers of this delegate is more than other's.
+         */
+        bool operator>(const DelegateBase &rhs)
+        {
+            return this->Count() > rhs.Count();
+        }
+
+        /**
+         * @brief           Signature of comparable delegates must match exactly.
+         * @param  rhs:     Other delegate.
+         * @returns         true if count of subscribers of this delegate is more or equals to other's.
+         */
+        bool operator>=(const DelegateBase &rhs)
+        {
+            return this->Count() >= rhs.Count();
+        }
+
+        /**
+         * @brief           Signature of comparable delegates must match exactly.
+         * @param  rhs:     Other delegate.
+         * @returns         true if subscribers of this delegate are equal to other's.
+         */
+        bool operator==(const DelegateBase &rhs)
+        {
+            return this->EqualSubscribers(rhs);
+        }
+
+        /**
+         * @brief           Signature of comparable delegates must match exactly.
+         * @param  rhs:     Other delegate.
+         * @returns         true if subscribers of this delegate are not-equal to other's.
+         */
+        bool operator!=(const DelegateBase &rhs)
+        {
+            return !this->EqualSubscribers(rhs);
+        }
+
+        /**
+         * @brief           Transfer all subscribers of other delegate to this delegate. Will clear subscribers from other delegate.
+         * @param  rhs:     Other delegate.
+         * @returns         Pointer to this delegate.
+         */
+        DelegateBase &operator<<(DelegateBase &rhs)
+        {
+            if (this != &rhs)
+            {
+                this->Combine(rhs);
+                rhs.Clear();
+            }
+            return *this;
+        }
+
+        /**
+         * @brief           Transfer all subscribers of this delegate to other delegate. Will clear subscribers from this delegate.
+         * @param  rhs:     Other delegate.
+         * @returns         Pointer to this delegate.
+         */
+        DelegateBase &operator>>(DelegateBase &rhs)
+        {
+            if (this != &rhs)
+            {
+                rhs.Combine(*this);
+                this->Clear();
+            }
+            return *this;
+        }
+
+        void DebugPrintParametersIndices()
+        {
+            for (size_t i = 0; i < parameters.Size(); i++)
+            {
+                if (this->IsSubscribed(parameters.Owner(i)))
+                {
+                    std::cout << slots[parameters.Owner(i).index].position << std::endl;
+                }
+            }
+        }
+
+    protected:
+        /**
+         * @brief           Call each batch subscriber having saved parameters packs with all of them.
+         */
+        void InvokeBatches()
+        {
+            for (auto &batch : batchSubscribers)
+            {
+                if (batch.function && batch.parameters.Size())
+                {
+                    batch.parameters.CallBatch(batch.function);
+                }
+            }
+        }
+
+        /**
+         * @brief           Drop emptied entries of unsubscribed functions and their saved parameters.
+         */
+        void Compact()
+        {
+            this->CompactSubscribers();
+            PurgeParameters();
+        }
+
+        /**
+         * @returns         Subscriber called by the saved call *row*, nullptr if it was unsubscribed.
+         */
+        const FunctionType *SavedFunction(size_t row) const
+        {
+            uint32_t position = parameters.Position(row);
+            return position != parameters.NoPosition && subscribers[position] ? &subscribers[position] : nullptr;
+        }
+
+        /**
+         * @brief           Move the subscriber called by the saved call *row* out, for a one-shot call that unsubscribes it.
+         * @note            Taken out of the subscribers: the call may subscribe new functions, growing them.
+         */
+        FunctionType TakeSavedFunction(size_t row)
+        {
+            uint32_t position = parameters.Position(row);
+            return position != parameters.NoPosition ? std::move(subscribers[position]) : FunctionType();
+        }
+
+        /**
+         * @brief           Unsubscribe the functions of the first *count* saved calls and drop these calls.
+         */
+        void ReleaseSavedCalls(size_t count)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                this->ReleaseSubscriber(parameters.Owner(i));
+            }
+            this->CompactSubscribers();
+            if (count == parameters.Size())
+            {
+                parameters.Clear();
+            }
+            else
+            {
+                parameters.RemoveIf([count](size_t row) { return row < count; });
+            }
+            UpdateParameterRows();
+        }
+
+    private:
+        void AttachParameters(SubscriptionHandle owner, const std::tuple<Params...> &tuple)
+        {
+            SetParameterRow(owner, parameters.Size());
+            parameters.Push(owner, slots[owner.index].position, tuple);
+        }
+
+        void AttachParameters(SubscriptionHandle owner, std::tuple<Params...> &&tuple)
+        {
+            SetParameterRow(owner, parameters.Size());
+            parameters.Push(owner, slots[owner.index].position, std::move(tuple));
+        }
+
+        /**
+         * @brief           Save a copy of the parameters of *original* (if it has any) for *copy*, invoked first or last.
+         */
+        void AttachParametersOf(SubscriptionHandle original, SubscriptionHandle copy, bool first)
+        {
+            uint32_t row = original.index < parameterRows.size() ? parameterRows[original.index] : NoRow;
+            if (row == NoRow || parameters.Owner(row) != original)
+            {
+                return;
+            }
+
+            SetParameterRow(copy, parameters.Size());
+            parameters.PushCopy(parameters, row, copy, slots[copy.index].position);
+            if (first)
+            {
+                parameters.RotateLastToFront();
+            }
+        }
+
+        void SetParameterRow(SubscriptionHandle owner, size_t row)
+        {
+            if (parameterRows.size() < slots.size())
+            {
+                parameterRows.resize(slots.size(), uint32_t(NoRow));
+            }
+            parameterRows[owner.index] = static_cast<uint32_t>(row);
+        }
+
+        /**
+         * @brief           Rebuild the row of each subscription and the subscriber position of each saved call, after the
+         *                  saved calls or the subscribers moved.
+         */
+        void UpdateParameterRows()
+        {
+            parameterRows.assign(slots.size(), uint32_t(NoRow));
+            for (size_t i = 0; i < parameters.Size(); i++)
+            {
+                SubscriptionHandle owner = parameters.Owner(i);
+                parameterRows[owner.index] = static_cast<uint32_t>(i);
+                parameters.SetPosition(i, this->IsSubscribed(owner) ? slots[owner.index].position : uint32_t(parameters.NoPosition));
+            }
+        }
+
+        /**
+         * @brief           Remove saved calls of unsubscribed functions.
+         */
+        void PurgeParameters()
+        {
+            parameters.RemoveIf([this](size_t row) { return !this->IsSubscribed(parameters.Owner(row)); });
+            UpdateParameterRows();
+        }
+    };
+
+    /**
+     * @brief  Delegate is a class that encapsulates a function(s).
+     * @note
+     * @tparam Allocator: Allocator of the subscribers and saved parameters, rebound to each stored type.
+     * @tparam Params: Any number of arguments of any type.
+     */
+    template <typename Allocator, typename... Params>
+    class BasicDelegate : public DelegateBase<Allocator, void, Params...>
+    {
+    public:
+        using Parent = DelegateBase<Allocator, void, Params...>;
+        using Parent::Clear;
+        using Parent::Invoke;
+        using Parent::subscribers;
+        using typename Parent::FunctionType;
+
+        BasicDelegate() = default;
+        explicit BasicDelegate(const Allocator &allocator) : Parent(allocator) {}
+
+        /**
+         * @brief           Completion object of InvokeAsync().
+         */
+        using Async = AsyncInvocation<void, Params...>;
+
+        /**
+         * @brief           Invoke all subscribed functions.
+         *
+         * @param  params:  Arguments of each subscribed function.
+         */
+        void operator()(ArgumentType<Params>... params)
+        {
+            for (auto &&i : subscribers)
+            {
+                if (i)
+                {
+                    i.CallShared(params...);
+                }
+            }
+        }
+
+        /**
+         * @brief           Invoke all subscribed functions in parallel on the executor of *policy*.
+         * @note            Subscribers must be safe to call concurrently; the delegate must not be modified until it returns.
+         *
+         * @param  policy:  Executor and grain, see Parallel().
+         * @param  params:  Arguments of each subscribed function.
+         */
+        template <typename Executor>
+        void operator()(ParallelPolicy<Executor> policy, ArgumentType<Params>... params)
+        {
+            policy.executor.ParallelFor(subscribers.size(), policy.grain, [&](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; i++)
+                {
+                    if (subscribers[i])
+                    {
+                        subscribers[i].CallShared(params...);
+                    }
+                }
+            });
+        }
+
+        /**
+         * @brief           Post a call of each subscribed function on *executor* and return without waiting for them.
+         * @note            Subscribers must be safe to call concurrently; the delegate must not be modified until
+         *                  *invocation* completed.
+         *
+         * @param  executor:    Executor providing Post() (see SequentialExecutor).
+         * @param  invocation:  Completion object to wait on or chain from, waited for first if still pending.
+         * @param  params:      Arguments of each subscribed function, copied into *invocation*.
+         */
+        template <typename Executor>
+        void InvokeAsync(Executor &executor, Async &invocation, ArgumentType<Params>... params)
+        {
+            invocation.Start(executor, subscribers, params...);
+        }
+    };
+
+    /**
+     * @brief  BasicDelegate using the default allocator.
+     */
+    template <typename... Params>
+    using Delegate = BasicDelegate<DefaultAllocator, Params...>;
+
+    /**
+     * @brief               Delegate with any return type specified.
+     *
+     * @tparam              Allocator Allocator of the subscribers and saved parameters, rebound to each stored type.
+     * @tparam              ReturnType Return type of the Delegate.
+     * @tparam              Params Any number of arguments of any type.
+     */
+    template <typename Allocator, typename ReturnType, typename... Params>
+    class BasicRetDelegate : public DelegateBase<Allocator, ReturnType, Params...>
+    {
+        static_assert(!std::is_void<ReturnType>::value, "RetDelegate can't have void return type!");
+
+        template <typename Reduction>
+        using EnableIfReduction = decltype(void(std::declval<ReturnType &>() = std::declval<Reduction &>()(std::declval<ReturnType>(), std::declval<ReturnType>())));
+
+    public:
+        using Parent = DelegateBase<Allocator, ReturnType, Params...>;
+        using Parent::Clear;
+        using Parent::InvokeParallel;
+        using Parent::parameters;
+        using Parent::subscribers;
+        using typename Parent::FunctionType;
+
+        BasicRetDelegate() = default;
+        explicit BasicRetDelegate(const Allocator &allocator) : Parent(allocator) {}
+
+        /**
+         * @brief           Completion object of InvokeAsync(), holding the sum of the results.
+         */
+        using Async = AsyncInvocation<ReturnType, Params...>;
+
+        /**
+         * @brief           Call all subscribed functions of this delegate that have parameters saved on subscription.
+         * @note
+         * @returns         Sum of results of each function invocation.
+         */
+        ReturnType Invoke()
+        {
+            return Invoke(SumResults<ReturnType>());
+        }
+
+        /**
+         * @brief           Call the functions that have parameters saved on subscription once, moving the saved parameters
+         *                  into the calls, then unsubscribe them (see DelegateBase::InvokeAndClear()).
+         * @returns         Sum of results of each function invocation.
+         */
+        ReturnType InvokeAndClear()
+        {
+            ReturnType result = ReturnType();
+            size_t count = parameters.Size();
+            for (size_t i = 0; i < count; i++)
+            {
+                FunctionType function = this->TakeSavedFunction(i);
+                if (function)
+                {
+                    result += parameters.Consume(function, i);
+                }
+            }
+            this->InvokeBatches();
+            this->ClearBatches();
+            this->ReleaseSavedCalls(count);
+            return result;
+        }
+
+        /**
+         * @brief           Call the functions that have parameters saved on subscription, combining their results.
+         * @note            Batch subscribers are called unless *combiner* stopped the invocation.
+         * @param  combiner:    Result combiner (see SumResults), may stop the invocation early.
+         * @returns         Combined result.
+         */
+        template <typename Combiner, typename = typename std::enable_if<IsCombiner<Combiner, ReturnType>::value>::type>
+        typename Combiner::ResultType Invoke(Combiner combiner)
+        {
+            size_t count = parameters.Size();
+            for (size_t i = 0; i < count; i++)
+            {
+                const FunctionType *function = this->SavedFunction(i);
+                if (function && !combiner(parameters.Invoke(*function, i)))
+                {
+                    return combiner.Result();
+                }
+            }
+            this->InvokeBatches();
+            return combiner.Result();
+        }
+
+        /**
+         * @brief           Group the saved calls by function (see GroupSavedCalls()) and call them.
+         * @returns         Sum of results of each function invocation.
+         */
+        ReturnType InvokeGrouped()
+        {
+            this->GroupSavedCalls();
+            return Invoke();
+        }
+
+        /**
+         * @brief           Invoke all functions subscribed to this delegate.
+         *
+         * @param  params:  Arguments of each subscribed function.
+         * @returns         Sum of all subscribed functions results.
+         */
+        ReturnType operator()(ArgumentType<Params>... params)
+        {
+            return (*this)(SumResults<ReturnType>(), params...);
+        }
+
+        /**
+         * @brief           Invoke all functions subscribed to this delegate, combining their results.
+         *
+         * @param  combiner:    Result combiner (see SumResults), may stop the invocation early.
+         * @param  params:      Arguments of each subscribed function.
+         * @returns         Combined result.
+         */
+        template <typename Combiner, typename = typename std::enable_if<IsCombiner<Combiner, ReturnType>::value>::type>
+        typename Combiner::ResultType operator()(Combiner combiner, ArgumentType<Params>... params)
+        {
+            for (auto &&i : subscribers)
+            {
+                if (i && !combiner(i.CallShared(params...)))
+                {
+                    break;
+                }
+            }
+            return combiner.Result();
+        }
+
+        /**
+         * @brief           Invoke all subscribed functions in parallel on the executor of *policy*, summing (*+=*) their results.
+         * @note            Subscribers must be safe to call concurrently; the delegate must not be modified until it returns.
+         *
+         * @param  policy:  Executor, grain and reduction order, see Parallel() and DeterministicParallel().
+         * @param  params:  Arguments of each subscribed function.
+         * @returns         Sum of all subscribed functions results.
+         */
+        template <typename Executor>
+        ReturnType operator()(ParallelPolicy<Executor> policy, ArgumentType<Params>... params)
+        {
+            return (*this)(policy, AddResults, params...);
+        }
+
+        /**
+         * @brief           Invoke all subscribed functions in parallel on the executor of *policy*, reducing their results
+         *                  with *reduce*.
+         * @note            Results of each chunk are reduced in subscription order, then the partial results of the chunks
+         *                  are reduced left to right, or over a fixed tree with DeterministicParallel(). Either way the
+         *                  results are combined in subscription order, so *reduce* needs not be commutative.
+         *
+         * @param  policy:  Executor, grain and reduction order, see Parallel() and DeterministicParallel().
+         * @param  reduce:  Associative function combining two results into one.
+         * @param  params:  Arguments of each subscribed function.
+         * @returns         Reduced result, *ReturnType()* if no function is subscribed.
+         */
+        template <typename Executor, typename Reduction, typename = EnableIfReduction<Reduction>>
+        ReturnType operator()(ParallelPolicy<Executor> policy, Reduction reduce, ArgumentType<Params>... params)
+        {
+            return ParallelReduce(policy, subscribers.size(), reduce, [&](size_t i, Partial &partial) {
+                if (subscribers[i])
+                {
+                    partial.Add(subscribers[i].CallShared(params...), reduce);
+                }
+            });
+        }
+
+        /**
+         * @brief           Post a call of each subscribed function on *executor* and return without waiting for them.
+         *                  Their results are summed (*+=*) into *invocation*, see AsyncInvocation::Result().
+         * @note            Subscribers must be safe to call concurrently; the delegate must not be modified until
+         *                  *invocation* completed.
+         *
+         * @param  executor:    Executor providing Post() (see SequentialExecutor).
+         * @param  invocation:  Completion object to wait on or chain from, waited for first if still pending.
+         * @param  params:      Arguments of each subscribed function, copied into *invocation*.
+         */
+        template <typename Executor>
+        void InvokeAsync(Executor &executor, Async &invocation, ArgumentType<Params>... params)
+        {
+            invocation.Start(executor, subscribers, params...);
+        }
+
+        /**
+         * @brief           Call all saved calls (see Invoke()) in parallel on the executor of *policy*, summing (*+=*)
+         *                  their results, then the batch subscribers.
+         * @returns         Sum of results of each function invocation.
+         */
+        template <typename Executor>
+        ReturnType InvokeParallel(ParallelPolicy<Executor> policy)
+        {
+            return InvokeParallel(policy, AddResults);
+        }
+
+        /**
+         * @brief           Call all saved calls (see Invoke()) in parallel on the executor of *policy*, reducing
+         *                  their results with *reduce*, then the batch subscribers.
+         * @returns         Reduced result, *ReturnType()* if there is no saved call.
+         */
+        template <typename Executor, typename Reduction, typename = EnableIfReduction<Reduction>>
+        ReturnType InvokeParallel(ParallelPolicy<Executor> policy, Reduction reduce)
+        {
+            ReturnType result = ParallelReduce(policy, parameters.Size(), reduce, [&](size_t i, Partial &partial) {
+                if (const FunctionType *function = this->SavedFunction(i))
+                {
+                    partial.Add(parameters.Invoke(*function, i), reduce);
+                }
+            });
+            this->InvokeBatches();
+            return result;
+        }
+
+        /**
+         * @brief           Call the subscribed functions until one returns a result satisfying *predicate*.
+         *
+         * @param  predicate:   Callable taking a result, returning true to stop.
+         * @param  params:      Arguments of each subscribed function.
+         * @returns         true if a function returned a result satisfying *predicate*.
+         */
+        template <typename Predicate>
+        bool CallUntil(Predicate predicate, ArgumentType<Params>... params)
+        {
+            return (*this)(UntilResult<ReturnType, Predicate>(std::move(predicate)), params...);
+        }
+
+        /**
+         * @brief           Call the subscribed functions until one returns true.
+         * @returns         true if any function returned true.
+         */
+        bool AnyOf(ArgumentType<Params>... params)
+        {
+            return (*this)(AnyResult(), params...);
+        }
+
+        /**
+         * @brief           Call the subscribed functions until one returns false.
+         * @returns         true if all functions returned true (or none is subscribed).
+         */
+        bool AllOf(ArgumentType<Params>... params)
+        {
+            return (*this)(AllResults(), params...);
+        }
 
         /**
-         * @brief           Transfer all subscribers of this delegate to other delegate. Will clear subscribers from this delegate.
-         * @param  rhs:     Other delegate.
-         * @returns         Pointer to this delegate.
+         * @brief           Call the functions that have parameters saved on subscription until one returns
+         *                  a result satisfying *predicate*.
+         * @returns         true if a function returned a result satisfying *predicate*.
          */
-        DelegateBase &operator>>(DelegateBase &rhs)
+        template <typename Predicate>
+        bool InvokeUntil(Predicate predicate)
         {
-            if (this != &rhs)
-            {
-                rhs.Combine(*this);
-                this->Clear();
-            }
-            return *this;
+            return Invoke(UntilResult<ReturnType, Predicate>(std::move(predicate)));
         }
 
-        void DebugPrintParametersIndices()
+        /**
+         * @brief           Call the functions that have parameters saved on subscription until one returns true.
+         * @returns         true if any function returned true.
+         */
+        bool InvokeAnyOf()
         {
-            for (auto &p : parameters)
-            {
-                std::cout << p.index << std::endl;
-            }
+            return Invoke(AnyResult());
         }
 
-    protected:
-        template <size_t... Indices>
-        ReturnType HelperInvoke(const std::tuple<Params...> &tuple, int index, std::index_sequence<Indices...>)
+        /**
+         * @brief           Call the functions that have parameters saved on subscription until one returns false.
+         * @returns         true if all functions returned true (or none has saved parameters).
+         */
+        bool InvokeAllOf()
         {
-            return subscribers[index](std::get<Indices>(tuple)...);
+            return Invoke(AllResults());
         }
 
     private:
-        void AttachParameters(Params... params)
-        {
-            this->parameters.push_back(FunctionParams<Params...>{subscribers.size() - 1, params...});
-        }
-        template <size_t... Indices>
-        void AttachParameters(const std::tuple<Params...> &tuple, std::index_sequence<Indices...>)
+        static ReturnType AddResults(ReturnType lhs, ReturnType rhs)
         {
-            this->parameters.push_back(FunctionParams<Params...>{subscribers.size() - 1, tuple});
+            lhs += std::move(rhs);
+            return lhs;
         }
-        void DetachParameters(const size_t index)
-        {
-            int erasedCount = 0;
 
-            // Removing all parameters with specified index
-            parameters.erase(
-                std::remove_if(
-                    parameters.begin(),
-                    parameters.end(),
-                    [index, &erasedCount](const FunctionParams<Params...> &x) {
-                        if (x.index == index)
-                        {
-                            erasedCount++;
-                            return true;
-                        }
-                        return false;
-                    }),
-                parameters.end());
+        /**
+         * @brief           Reduced results of a run of calls.
+         */
+        struct Partial
+        {
+            ReturnType value = ReturnType();
+            bool empty = true;
 
-            if (index > 0)
+            template <typename Reduction>
+            void Add(ReturnType result, const Reduction &reduce)
             {
-                return;
+                value = empty ? std::move(result) : reduce(std::move(value), std::move(result));
+                empty = false;
             }
 
-            // Correcting indices of saved parameters
-            for (size_t i = 0; i < parameters.size(); ++i)
+            template <typename Reduction>
+            void Merge(Partial &other, const Reduction &reduce)
             {
-                parameters[i].index -= erasedCount;
+                if (!other.empty)
+                {
+                    Add(std::move(other.value), reduce);
+                }
             }
-        }
-    };
-
-    /**
-     * @brief  Delegate is a class that encapsulates a function(s).
-     * @note   
-     * @tparam Params: Any number of arguments of any type.
-     */
-    template <typename... Params>
-    class Delegate : public DelegateBase<void, Params...>
-    {
-    public:
-        using Parent = DelegateBase<void, Params...>;
-        using Parent::Clear;
-        using Parent::Invoke;
-        using Parent::subscribers;
-        using typename Parent::FunctionType;
+        };
 
         /**
-         * @brief           Invoke all subscribed functions.
-         * 
-         * @param  params:  Arguments of each subscribed function.
+         * @brief           Reduce the results of *call(i, partial)* for i in [0, count) in parallel.
          */
-        void operator()(Params... params)
+        template <typename Executor, typename Reduction, typename Call>
+        static ReturnType ParallelReduce(ParallelPolicy<Executor> policy, size_t count, const Reduction &reduce, const Call &call)
         {
-            for (auto &&i : subscribers)
+            if (!policy.deterministic)
             {
-                i(params...);
+                // Chunks complete in any order: keep each partial with the first index of its chunk, then reduce
+                // them left to right, so *reduce* doesn't need to be commutative.
+                std::vector<std::pair<size_t, Partial>> chunks;
+                std::mutex mutex;
+                policy.executor.ParallelFor(count, policy.grain, [&](size_t begin, size_t end) {
+                    Partial partial;
+                    for (size_t i = begin; i < end; i++)
+                    {
+                        call(i, partial);
+                    }
+                    std::lock_guard<std::mutex> lock(mutex);
+                    chunks.emplace_back(begin, std::move(partial));
+                });
+
+                std::sort(chunks.begin(), chunks.end(), [](const std::pair<size_t, Partial> &lhs, const std::pair<size_t, Partial> &rhs) {
+                    return lhs.first < rhs.first;
+                });
+                Partial total;
+                for (auto &&chunk : chunks)
+                {
+                    total.Merge(chunk.second, reduce);
+                }
+                return std::move(total.value);
             }
-        }
-    };
-
-    /**
-     * @brief               Delegate with any return type specified.
-     * 
-     * @tparam              ReturnType Return type of the Delegate.
-     * @tparam              Params Any number of arguments of any type.
-     */
-    template <typename ReturnType, typename... Params>
-    class RetDelegate : public DelegateBase<ReturnType, Params...>
-    {
-        static_assert(!std::is_void<ReturnType>::value, "RetDelegate can't have void return type!");
 
-    public:
-        using Parent = DelegateBase<ReturnType, Params...>;
-        using Parent::Clear;
-        using Parent::HelperInvoke;
-        using Parent::parameters;
-        using Parent::subscribers;
-        using typename Parent::FunctionType;
-
-        /**
-         * @brief           Call all subscribed functions of this delegate that have parameters saved on subscription.
-         * @note            
-         * @returns         Sum of results of each function invocation.
-         */
-        ReturnType Invoke()
-        {
-            ReturnType result = ReturnType();
-            for (size_t i = 0; i < parameters.size(); i++)
-            {
-                result += HelperInvoke(parameters[i].parameters, i, std::index_sequence_for<Params...>());
-            }
-            return result;
-        }
+            size_t leaf = policy.grain ? policy.grain : 64;
+            size_t leaves = (count + leaf - 1) / leaf;
+            std::vector<Partial> partials(leaves);
+            policy.executor.ParallelFor(leaves, 1, [&](size_t begin, size_t end) {
+                for (size_t l = begin; l < end; l++)
+                {
+                    for (size_t i = l * leaf; i < count && i < (l + 1) * leaf; i++)
+                    {
+                        call(i, partials[l]);
+                    }
+                }
+            });
 
-        /**
-         * @brief           Invoke all functions subscribed to this delegate.
-         * 
-         * @param  params:  Arguments of each subscribed function.
-         * @returns         Sum of all subscribed functions results.
-         */
-        ReturnType operator()(Params... params)
-        {
-            ReturnType sum = ReturnType();
-            for (auto &&i : subscribers)
+            for (size_t stride = 1; stride < leaves; stride *= 2)
             {
-                sum += i(params...);
+                for (size_t l = 0; l + stride < leaves; l += 2 * stride)
+                {
+                    partials[l].Merge(partials[l + stride], reduce);
+                }
             }
-            return sum;
+            return leaves ? std::move(partials[0].value) : ReturnType();
         }
     };
 
+    /**
+     * @brief  BasicRetDelegate using the default allocator.
+     */
+    template <typename ReturnType, typename... Params>
+    using RetDelegate = BasicRetDelegate<DefaultAllocator, ReturnType, Params...>;
+
     /**
      * @brief  Delegate that holds the subscribed member functions.
      * @note   
+     * @tparam Allocator    Allocator of the subscribers and saved parameters.
      * @tparam ReturnType   Return type of the Delegate.
      * @tparam ObjType      Type of the member function owner class.
      * @tparam Params       Any number of arguments of any type.
      */
-    template <typename ReturnType, class ObjType, typename... Params>
+    template <typename Allocator, typename ReturnType, class ObjType, typename... Params>
     class MemberDelegateBase
     {
         template <typename... T>
@@ -624,16 +3203,24 @@ namespace dw
         /**
          * @brief           **std::vector** of methods that are subscribed to this delegate.
          */
-        std::vector<MemberFunctionType> subscribers;
+        AllocatorVector<MemberFunctionType, Allocator> subscribers;
 
         /**
          * @brief           Vector of parameters saved when each method is subscribed to this delegate.
          */
-        std::vector<MemberFunctionParams<Params...>> parameters;
+        AllocatorVector<MemberFunctionParams<Params...>, Allocator> parameters;
+
+        MemberDelegateBase() : MemberDelegateBase(Allocator()) {}
 
-        MemberDelegateBase() = default;
+        explicit MemberDelegateBase(const Allocator &allocator) : subscribers(allocator), parameters(allocator) {}
 
     public:
+        using AllocatorType = Allocator;
+
+        /**
+         * @returns         Allocator of the subscribers and parameters storage.
+         */
+        Allocator GetAllocator() const { return Allocator(subscribers.get_allocator()); }
 
         /**
          * @brief           Subscribe single method for a choosen object with the specified parameters.
@@ -722,15 +3309,18 @@ namespace dw
         }
     };
 
-    template <class ObjType, typename... Params>
-    class MemberDelegate : public MemberDelegateBase<void, ObjType, Params...>
+    template <typename Allocator, class ObjType, typename... Params>
+    class BasicMemberDelegate : public MemberDelegateBase<Allocator, void, ObjType, Params...>
     {
     public:
-        using Parent = MemberDelegateBase<void, ObjType, Params...>;
+        using Parent = MemberDelegateBase<Allocator, void, ObjType, Params...>;
         using Parent::parameters;
         using Parent::subscribers;
         using typename Parent::MemberFunctionType;
 
+        BasicMemberDelegate() = default;
+        explicit BasicMemberDelegate(const Allocator &allocator) : Parent(allocator) {}
+
         /**
          * @brief           Call all subscribed methods of this delegate that have parameters saved on subscription.
          */
@@ -738,7 +3328,7 @@ namespace dw
         {
             for (size_t i = 0; i < parameters.size(); i++)
             {
-                HelperMemberInvoke(parameters[i].object, parameters[i].parameters, i, std::index_sequence_for<Params...>());
+                HelperMemberInvoke(parameters[i].object, parameters[i].parameters, parameters[i].index, std::index_sequence_for<Params...>());
             }
             return;
         }
@@ -749,7 +3339,7 @@ namespace dw
          * @param  params:  Method parameters pack.
          * @retval None
          */
-        void operator()(ObjType *obj, Params... params)
+        void operator()(ObjType *obj, ArgumentType<Params>... params)
         {
             for (auto &&i : subscribers)
             {
@@ -759,34 +3349,56 @@ namespace dw
 
     private:
         template <size_t... Indices>
-        void HelperMemberInvoke(ObjType *obj, const std::tuple<Params...> &tuple, int index, std::index_sequence<Indices...>)
+        void HelperMemberInvoke(ObjType *obj, const std::tuple<Params...> &tuple, size_t index, std::index_sequence<Indices...>)
         {
             (obj->*subscribers[index])(std::get<Indices>(tuple)...);
         }
     };
 
-    template <typename ReturnType, class ObjType, typename... Params>
-    class RetMemberDelegate : public MemberDelegateBase<ReturnType, ObjType, Params...>
+    /**
+     * @brief  BasicMemberDelegate using the default allocator.
+     */
+    template <class ObjType, typename... Params>
+    using MemberDelegate = BasicMemberDelegate<DefaultAllocator, ObjType, Params...>;
+
+    template <typename Allocator, typename ReturnType, class ObjType, typename... Params>
+    class BasicRetMemberDelegate : public MemberDelegateBase<Allocator, ReturnType, ObjType, Params...>
     {
         static_assert(!std::is_void<ReturnType>::value, "RetMemberDelegate can't have void return type!");
 
     public:
-        using Parent = MemberDelegateBase<ReturnType, ObjType, Params...>;
+        using Parent = MemberDelegateBase<Allocator, ReturnType, ObjType, Params...>;
         using Parent::parameters;
         using Parent::subscribers;
         using typename Parent::MemberFunctionType;
 
+        BasicRetMemberDelegate() = default;
+        explicit BasicRetMemberDelegate(const Allocator &allocator) : Parent(allocator) {}
+
         /**
          * @brief           Call all subscribed methods of this delegate that have parameters saved on subscription.
          */
         ReturnType Invoke()
         {
-            ReturnType result = ReturnType();
+            return Invoke(SumResults<ReturnType>());
+        }
+
+        /**
+         * @brief           Call all subscribed methods that have parameters saved on subscription, combining their results.
+         * @param  combiner:    Result combiner (see SumResults), may stop the invocation early.
+         * @returns         Combined result.
+         */
+        template <typename Combiner, typename = typename std::enable_if<IsCombiner<Combiner, ReturnType>::value>::type>
+        typename Combiner::ResultType Invoke(Combiner combiner)
+        {
             for (size_t i = 0; i < parameters.size(); i++)
             {
-                result += HelperMemberInvoke(parameters[i].object, parameters[i].parameters, i, std::index_sequence_for<Params...>());
+                if (!combiner(HelperMemberInvoke(parameters[i].object, parameters[i].parameters, parameters[i].index, std::index_sequence_for<Params...>())))
+                {
+                    break;
+                }
             }
-            return result;
+            return combiner.Result();
         }
 
         /**
@@ -795,24 +3407,279 @@ namespace dw
          * @param  params:  Method parameters pack.
          * @retval None
          */
-        ReturnType operator()(ObjType *obj, Params... params)
+        ReturnType operator()(ObjType *obj, ArgumentType<Params>... params)
+        {
+            return (*this)(SumResults<ReturnType>(), obj, params...);
+        }
+
+        /**
+         * @brief           Calls subscribed methods with the specified parameters, combining their results.
+         * @param  combiner:    Result combiner (see SumResults), may stop the invocation early.
+         * @param  obj:     Pointer to an object that will call *all* subscribed methods of this delegate.
+         * @param  params:  Method parameters pack.
+         * @returns         Combined result.
+         */
+        template <typename Combiner, typename = typename std::enable_if<IsCombiner<Combiner, ReturnType>::value>::type>
+        typename Combiner::ResultType operator()(Combiner combiner, ObjType *obj, ArgumentType<Params>... params)
         {
-            ReturnType result = ReturnType();
             for (auto &&i : subscribers)
             {
-                result += (obj->*i)(params...);
+                if (!combiner((obj->*i)(params...)))
+                {
+                    break;
+                }
             }
-            return result;
+            return combiner.Result();
         }
 
     private:
         template <size_t... Indices>
-        ReturnType HelperMemberInvoke(ObjType *obj, const std::tuple<Params...> &tuple, int index, std::index_sequence<Indices...>)
+        ReturnType HelperMemberInvoke(ObjType *obj, const std::tuple<Params...> &tuple, size_t index, std::index_sequence<Indices...>)
         {
             return (obj->*subscribers[index])(std::get<Indices>(tuple)...);
         }
     };
 
+    /**
+     * @brief  BasicRetMemberDelegate using the default allocator.
+     */
+    template <typename ReturnType, class ObjType, typename... Params>
+    using RetMemberDelegate = BasicRetMemberDelegate<DefaultAllocator, ReturnType, ObjType, Params...>;
+
+    /**
+     * @brief  Base class of delegates that hold (object, method) pairs.
+     * @note   Every subscriber is bound at compile time to a thunk calling one specific method, so it is stored
+     *         as two pointers and called with a single indirect call, whatever the object it belongs to.
+     * @tparam Allocator    Allocator of the subscribers.
+     * @tparam ReturnType   Return type of the Delegate.
+     * @tparam Params       Any number of arguments of any type.
+     */
+    template <typename Allocator, typename ReturnType, typename... Params>
+    class BoundDelegateBase
+    {
+    protected:
+        /**
+         * @brief           Object bound to the thunk calling its method.
+         */
+        struct BoundMethod
+        {
+            void *object;
+            ReturnType (*thunk)(void *, ArgumentType<Params>...);
+
+            bool operator==(const BoundMethod &rhs) const { return object == rhs.object && thunk == rhs.thunk; }
+        };
+
+        /**
+         * @brief           **std::vector** of (object, method) pairs that are subscribed to this delegate.
+         */
+        AllocatorVector<BoundMethod, Allocator> subscribers;
+
+        BoundDelegateBase() : BoundDelegateBase(Allocator()) {}
+
+        explicit BoundDelegateBase(const Allocator &allocator) : subscribers(allocator) {}
+
+    public:
+        using AllocatorType = Allocator;
+
+        /**
+         * @returns         Allocator of the subscribers storage.
+         */
+        Allocator GetAllocator() const { return Allocator(subscribers.get_allocator()); }
+        /**
+         * @brief           Subscribe *Method* called on *obj*.
+         * @note            Usage: `del.Subscribe<Connection, &Connection::OnData>(&connection);`
+         * @param  obj:     Pointer to an object that must outlive its subscription.
+         */
+        template <class ObjType, ReturnType (ObjType::*Method)(Params...)>
+        void Subscribe(ObjType *obj)
+        {
+            subscribers.push_back(BoundMethod{obj, &Thunk<ObjType, Method>});
+        }
+
+        /**
+         * @brief           Subscribe const *Method* called on *obj*.
+         * @param  obj:     Pointer to an object that must outlive its subscription.
+         */
+        template <class ObjType, ReturnType (ObjType::*Method)(Params...) const>
+        void Subscribe(const ObjType *obj)
+        {
+            subscribers.push_back(BoundMethod{const_cast<ObjType *>(obj), &ConstThunk<ObjType, Method>});
+        }
+
+        /**
+         * @brief           Unsubscribe *Method* bound to *obj*.
+         * @param  obj:     Pointer to the object the method was subscribed with.
+         */
+        template <class ObjType, ReturnType (ObjType::*Method)(Params...)>
+        void Unsubscribe(ObjType *obj)
+        {
+            BoundMethod bound{obj, &Thunk<ObjType, Method>};
+            subscribers.erase(std::remove(subscribers.begin(), subscribers.end(), bound), subscribers.end());
+        }
+
+        /**
+         * @brief           Unsubscribe const *Method* bound to *obj*.
+         * @param  obj:     Pointer to the object the method was subscribed with.
+         */
+        template <class ObjType, ReturnType (ObjType::*Method)(Params...) const>
+        void Unsubscribe(const ObjType *obj)
+        {
+            BoundMethod bound{const_cast<ObjType *>(obj), &ConstThunk<ObjType, Method>};
+            subscribers.erase(std::remove(subscribers.begin(), subscribers.end(), bound), subscribers.end());
+        }
+
+        /**
+         * @brief           Unsubscribe every method bound to *obj*, e.g. before the object is destroyed.
+         * @param  obj:     Pointer to the object whose methods must be removed.
+         */
+        void UnsubscribeAll(const void *obj)
+        {
+            auto boundTo = [obj](const BoundMethod &x) -> bool { return x.object == obj; };
+
+            subscribers.erase(std::remove_if(subscribers.begin(), subscribers.end(), boundTo), subscribers.end());
+        }
+
+        /**
+         * @brief           Remove all subscribed methods from this delegate.
+         */
+        void Clear()
+        {
+            subscribers.clear();
+        }
+
+        /**
+         * @returns         Count of subscribed (object, method) pairs.
+         */
+        size_t Count() const { return subscribers.size(); }
+
+    private:
+        template <class ObjType, ReturnType (ObjType::*Method)(Params...)>
+        static ReturnType Thunk(void *obj, ArgumentType<Params>... params)
+        {
+            return (static_cast<ObjType *>(obj)->*Method)(std::forward<ArgumentType<Params>>(params)...);
+        }
+
+        template <class ObjType, ReturnType (ObjType::*Method)(Params...) const>
+        static ReturnType ConstThunk(void *obj, ArgumentType<Params>... params)
+        {
+            return (static_cast<const ObjType *>(obj)->*Method)(std::forward<ArgumentType<Params>>(params)...);
+        }
+    };
+
+    /**
+     * @brief  Delegate that calls methods with void return type, each on its own object.
+     * @tparam Allocator    Allocator of the subscribers.
+     * @tparam Params       Any number of arguments of any type.
+     */
+    template <typename Allocator, typename... Params>
+    class BasicBoundDelegate : public BoundDelegateBase<Allocator, void, Params...>
+    {
+    public:
+        using Parent = BoundDelegateBase<Allocator, void, Params...>;
+        using Parent::subscribers;
+
+        BasicBoundDelegate() = default;
+        explicit BasicBoundDelegate(const Allocator &allocator) : Parent(allocator) {}
+
+        /**
+         * @brief           Call every subscribed method on the object it was subscribed with.
+         * @param  params:  Method parameters pack.
+         */
+        void operator()(ArgumentType<Params>... params)
+        {
+            for (auto &&i : subscribers)
+            {
+                i.thunk(i.object, params...);
+            }
+        }
+    };
+
+    /**
+     * @brief  BasicBoundDelegate using the default allocator.
+     */
+    template <typename... Params>
+    using BoundDelegate = BasicBoundDelegate<DefaultAllocator, Params...>;
+
+    /**
+     * @brief  Delegate that calls methods with any specified return type (but not void), each on its own object.
+     * @tparam Allocator    Allocator of the subscribers.
+     * @tparam ReturnType   Return type of the Delegate.
+     * @tparam Params       Any number of arguments of any type.
+     */
+    template <typename Allocator, typename ReturnType, typename... Params>
+    class BasicRetBoundDelegate : public BoundDelegateBase<Allocator, ReturnType, Params...>
+    {
+        static_assert(!std::is_void<ReturnType>::value, "RetBoundDelegate can't have void return type!");
+
+    public:
+        using Parent = BoundDelegateBase<Allocator, ReturnType, Params...>;
+        using Parent::subscribers;
+
+        BasicRetBoundDelegate() = default;
+        explicit BasicRetBoundDelegate(const Allocator &allocator) : Parent(allocator) {}
+
+        /**
+         * @brief           Call every subscribed method on the object it was subscribed with.
+         * @param  params:  Method parameters pack.
+         * @returns         Sum of all called methods results.
+         */
+        ReturnType operator()(ArgumentType<Params>... params)
+        {
+            return (*this)(SumResults<ReturnType>(), params...);
+        }
+
+        /**
+         * @brief           Call every subscribed method on the object it was subscribed with, combining their results.
+         * @param  combiner:    Result combiner (see SumResults), may stop the invocation early.
+         * @param  params:      Method parameters pack.
+         * @returns         Combined result.
+         */
+        template <typename Combiner, typename = typename std::enable_if<IsCombiner<Combiner, ReturnType>::value>::type>
+        typename Combiner::ResultType operator()(Combiner combiner, ArgumentType<Params>... params)
+        {
+            for (auto &&i : subscribers)
+            {
+                if (!combiner(i.thunk(i.object, params...)))
+                {
+                    break;
+                }
+            }
+            return combiner.Result();
+        }
+    };
+
+    /**
+     * @brief  BasicRetBoundDelegate using the default allocator.
+     */
+    template <typename ReturnType, typename... Params>
+    using RetBoundDelegate = BasicRetBoundDelegate<DefaultAllocator, ReturnType, Params...>;
+
+#if DW_HAS_PMR
+    /**
+     * @brief  Delegates allocating from a std::pmr::memory_resource, e.g. a per-frame std::pmr::monotonic_buffer_resource.
+     * @note   Pass the resource to the constructor: `dw::pmr::Delegate<int> del(&arena);`.
+     */
+    namespace pmr
+    {
+        using Allocator = std::pmr::polymorphic_allocator<std::byte>;
+
+        template <typename... Params>
+        using SimpleDelegate = BasicSimpleDelegate<Allocator, Params...>;
+        template <typename... Params>
+        using Delegate = BasicDelegate<Allocator, Params...>;
+        template <typename ReturnType, typename... Params>
+        using RetDelegate = BasicRetDelegate<Allocator, ReturnType, Params...>;
+        template <class ObjType, typename... Params>
+        using MemberDelegate = BasicMemberDelegate<Allocator, ObjType, Params...>;
+        template <typename ReturnType, class ObjType, typename... Params>
+        using RetMemberDelegate = BasicRetMemberDelegate<Allocator, ReturnType, ObjType, Params...>;
+        template <typename... Params>
+        using BoundDelegate = BasicBoundDelegate<Allocator, Params...>;
+        template <typename ReturnType, typename... Params>
+        using RetBoundDelegate = BasicRetBoundDelegate<Allocator, ReturnType, Params...>;
+    } // namespace pmr
+#endif
+
     // template <typename... Params>
     // class MasterDelegate : public Delegate<Params...>
     // {
@@ -0,0 +1,155 @@
+#pragma once
+
+#include "Delegate.h"
+
+#include <mutex>
+
+namespace dw
+{
+    /**
+     * @brief  Deferred calls recorded into a back buffer by any number of producer threads while one consumer thread
+     *         executes the front buffer, the buffers being swapped at a frame boundary.
+     * @note   Each buffer stores the functions and each parameter in their own column. Executing
+     *         moves the parameters into the calls, then empties the buffer keeping its capacity, so once the buffers
+     *         have grown to the largest frame, recording and executing no longer allocate. Swap() exchanges the
+     *         buffers in O(1). Recording takes a mutex that only producers and Swap() contend for; executing takes none.
+     *         Calls recorded by executed functions go to the back buffer, for the next frame.
+     * @tparam Allocator    Allocator of the buffers.
+     * @tparam Params       Any number of arguments of any type.
+     */
+    template <typename Allocator, typename... Params>
+    class BasicDoubleBufferedDelegate
+    {
+    public:
+        using FunctionType = Callable<void, Params...>;
+        using AllocatorType = Allocator;
+
+        BasicDoubleBufferedDelegate() : BasicDoubleBufferedDelegate(Allocator()) {}
+        explicit BasicDoubleBufferedDelegate(const Allocator &allocator) : buffers{Buffer(allocator), Buffer(allocator)} {}
+
+        BasicDoubleBufferedDelegate(const BasicDoubleBufferedDelegate &) = delete;
+        BasicDoubleBufferedDelegate &operator=(const BasicDoubleBufferedDelegate &) = delete;
+
+        /**
+         * @brief           Record a call of *function* with *params* into the back buffer. Thread-safe.
+         * @note            Values are moved into the buffer: pass rvalues to record them without a copy. Execute() moves them
+         *                  into the call, so move-only parameters can be taken by value.
+         */
+        void Record(const FunctionType &function, Params... params)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            buffers[back].functions.push_back(function);
+            buffers[back].parameters.Push(std::tuple<Params...>(std::forward<Params>(params)...));
+        }
+
+        /**
+         * @brief           Make the recorded calls the front buffer, and the executed front buffer the new back buffer.
+         * @note            Consumer thread, at a frame boundary. Doesn't swap if the front buffer wasn't executed yet.
+         * @returns         false if the front buffer still holds calls.
+         */
+        bool Swap()
+        {
+            if (!buffers[1 - back].functions.empty())
+            {
+                return false;
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            back = 1 - back;
+            return true;
+        }
+
+        /**
+         * @brief           Call every function of the front buffer in recording order, moving its parameters into the
+         *                  call, then empty the buffer keeping its capacity. Consumer thread.
+         * @returns         Count of executed calls.
+         */
+        size_t Execute()
+        {
+            Buffer &front = buffers[1 - back];
+            size_t count = front.functions.size();
+            for (size_t i = 0; i < count; i++)
+            {
+                front.parameters.Consume(front.functions[i], i);
+            }
+            front.Clear();
+            return count;
+        }
+
+        /**
+         * @brief           Reserve room for *count* calls in both buffers, e.g. before the first frame.
+         */
+        void Reserve(size_t count)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            buffers[0].Reserve(count);
+            buffers[1].Reserve(count);
+        }
+
+        /**
+         * @returns         Count of calls recorded into the back buffer.
+         */
+        size_t Recorded() const
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return buffers[back].functions.size();
+        }
+
+        /**
+         * @returns         Count of calls of the front buffer waiting for Execute(). Consumer thread.
+         */
+        size_t Pending() const { return buffers[1 - back].functions.size(); }
+
+        /**
+         * @brief           Drop the calls of both buffers without calling them. Consumer thread.
+         */
+        void Clear()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            buffers[0].Clear();
+            buffers[1].Clear();
+        }
+
+    private:
+        /**
+         * @brief           Recorded calls: function and saved parameters of each call, by row.
+         */
+        struct Buffer
+        {
+            explicit Buffer(const Allocator &allocator) : functions(allocator), parameters(allocator) {}
+
+            void Reserve(size_t count)
+            {
+                functions.reserve(count);
+                parameters.Reserve(count);
+            }
+
+            void Clear()
+            {
+                functions.clear();
+                parameters.Clear();
+            }
+
+            AllocatorVector<FunctionType, Allocator> functions;
+            ParameterColumns<Allocator, Params...> parameters;
+        };
+
+        Buffer buffers[2];
+        size_t back = 0;
+        mutable std::mutex mutex;
+    };
+
+    /**
+     * @brief  BasicDoubleBufferedDelegate using the default allocator.
+     */
+    template <typename... Params>
+    using DoubleBufferedDelegate = BasicDoubleBufferedDelegate<DefaultAllocator, Params...>;
+
+#if DW_HAS_PMR
+    namespace pmr
+    {
+        template <typename... Params>
+        using DoubleBufferedDelegate = BasicDoubleBufferedDelegate<Allocator, Params...>;
+    } // namespace pmr
+#endif
+} // namespace dw
@@ -0,0 +1,410 @@
+#pragma once
+
+#include "Delegate.h"
+
+#include <cassert>
+#include <exception>
+
+namespace dw
+{
+    /**
+     * @brief  What an InlineDelegate does with a subscription that doesn't fit anymore.
+     */
+    enum class InlineOverflow
+    {
+        Reject,    ///< Don't subscribe: the returned handle is invalid and operator+= does nothing.
+        Assert,    ///< assert() in debug builds, Reject otherwise.
+        Terminate  ///< Call std::terminate().
+    };
+
+    /**
+     * @brief  Delegate storing up to *Capacity* subscribers, and up to *Capacity* saved parameters packs, inside the object.
+     * @note   Never allocates and reaches its subscribers without a pointer chase. Removal shifts the following entries,
+     *         which is cheap for the handful of subscribers it is meant for.
+     *         Constructing it from more than *Capacity* functions fails at compile time; subscriptions past *Capacity*
+     *         are handled by *Overflow*.
+     * @tparam Capacity     Maximum count of subscribers and of saved parameters packs.
+     * @tparam Overflow     Overflow policy of runtime subscriptions.
+     * @tparam ReturnType   Return type of the subscribed functions.
+     * @tparam Params       Any number of arguments of any type.
+     */
+    template <size_t Capacity, InlineOverflow Overflow, typename ReturnType, typename... Params>
+    class BasicInlineDelegate
+    {
+        static_assert(Capacity > 0 && Capacity < UINT32_MAX, "InlineDelegate capacity out of range!");
+
+    public:
+        using FunctionType = Callable<ReturnType, Params...>;
+
+    private:
+        using Arguments = std::tuple<typename ParameterColumn<Params>::Type...>;
+        using Sequence = std::index_sequence_for<Params...>;
+
+        /**
+         * @brief           Saved parameters of the subscription *owner*, called through its subscriber (see positions),
+         *                  so a subscription has a single target whether it is called by operator() or Invoke().
+         */
+        struct SavedCall
+        {
+            SubscriptionHandle owner;
+            Arguments arguments;
+        };
+
+    public:
+        BasicInlineDelegate() = default;
+
+        /**
+         * @brief           Subscribe *functions*, checking at compile time that they fit.
+         */
+        template <typename Function, typename... Functions,
+                  typename = typename std::enable_if<!std::is_same<typename std::decay<Function>::type, BasicInlineDelegate>::value>::type>
+        explicit BasicInlineDelegate(Function &&function, Functions &&...functions)
+        {
+            static_assert(1 + sizeof...(Functions) <= Capacity, "Too many functions for the InlineDelegate capacity!");
+            int expand[] = {(Add(FunctionType(std::forward<Function>(function))), 0), (Add(FunctionType(std::forward<Functions>(functions))), 0)...};
+            (void)expand;
+        }
+
+        BasicInlineDelegate(const BasicInlineDelegate &other) { CopyFrom(other); }
+
+        BasicInlineDelegate &operator=(const BasicInlineDelegate &other)
+        {
+            if (this != &other)
+            {
+                Clear();
+                CopyFrom(other);
+            }
+            return *this;
+        }
+
+        ~BasicInlineDelegate() { ClearSaved(); }
+
+        /**
+         * @returns         Maximum count of subscribers.
+         */
+        static constexpr size_t MaxCount() { return Capacity; }
+
+        /**
+         * @returns         Count of subscribed functions.
+         */
+        size_t Count() const { return count; }
+
+        /**
+         * @returns         true if no more function can be subscribed.
+         */
+        bool Full() const { return count == Capacity; }
+
+        /**
+         * @returns         true if the subscription of *handle* was not removed yet.
+         */
+        bool IsSubscribed(SubscriptionHandle handle) const
+        {
+            return handle.index < Capacity && used[handle.index] && generations[handle.index] == handle.generation;
+        }
+
+        /**
+         * @brief           Subscribe *function*.
+         * @returns         Handle of the subscription, invalid if it didn't fit (see InlineOverflow).
+         */
+        SubscriptionHandle Add(const FunctionType &function)
+        {
+            if (count == Capacity)
+            {
+                return Overflowed();
+            }
+
+            uint32_t slot = 0;
+            while (used[slot])
+            {
+                ++slot;
+            }
+            used[slot] = true;
+            subscribers[count] = function;
+            owners[count] = slot;
+            positions[slot] = count;
+            count++;
+            return SubscriptionHandle{slot, generations[slot]};
+        }
+
+        /**
+         * @brief           Subscribe *function* and save *params* for Invoke().
+         * @note            Values are moved into the saved pack: pass rvalues to save them without a copy.
+         * @returns         Handle of the subscription, invalid if the function or the parameters didn't fit.
+         */
+        SubscriptionHandle Subscribe(const FunctionType &function, Params... params)
+        {
+            if (savedCount == Capacity)
+            {
+                return Overflowed();
+            }
+
+            SubscriptionHandle handle = Add(function);
+            if (IsSubscribed(handle))
+            {
+                ::new (static_cast<void *>(&saved[savedCount])) SavedCall{handle, Arguments(Moved<Params>(params)...)};
+                savedCount++;
+            }
+            return handle;
+        }
+
+        /**
+         * @brief           Remove the subscription of *handle* and its saved parameters.
+         * @returns         true if the subscription existed.
+         */
+        bool Unsubscribe(SubscriptionHandle handle)
+        {
+            if (!IsSubscribed(handle))
+            {
+                return false;
+            }
+
+            size_t position = 0;
+            while (owners[position] != handle.index)
+            {
+                ++position;
+            }
+            RemoveAt(position);
+            return true;
+        }
+
+        /**
+         * @brief           Call the functions that have parameters saved on subscription.
+         * @returns         Sum of their results, if *ReturnType* is not void.
+         */
+        ReturnType Invoke() const
+        {
+            return Invoke(std::is_void<ReturnType>());
+        }
+
+        /**
+         * @brief           Invoke all subscribed functions.
+         *
+         * @param  params:  Arguments of each subscribed function.
+         * @returns         Sum of their results, if *ReturnType* is not void.
+         */
+        ReturnType operator()(ArgumentType<Params>... params) const
+        {
+            return Call(std::is_void<ReturnType>(), params...);
+        }
+
+        /**
+         * @brief           Invoke all subscribed functions, combining their results.
+         *
+         * @param  combiner:    Result combiner (see SumResults), may stop the invocation early.
+         * @param  params:      Arguments of each subscribed function.
+         * @returns         Combined result.
+         */
+        template <typename Combiner, typename = typename std::enable_if<IsCombiner<Combiner, ReturnType>::value>::type>
+        typename Combiner::ResultType operator()(Combiner combiner, ArgumentType<Params>... params) const
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                if (!combiner(subscribers[i].CallShared(params...)))
+                {
+                    break;
+                }
+            }
+            return combiner.Result();
+        }
+
+        BasicInlineDelegate &operator+=(const FunctionType &rhs)
+        {
+            Add(rhs);
+            return *this;
+        }
+
+        BasicInlineDelegate &operator+=(const std::initializer_list<FunctionType> &rhs)
+        {
+            for (auto &&i : rhs)
+            {
+                Add(i);
+            }
+            return *this;
+        }
+
+        /**
+         * @brief           Unsubscribe every subscription of *rhs*, with its saved parameters.
+         */
+        BasicInlineDelegate &operator-=(const FunctionType &rhs)
+        {
+            size_t i = 0;
+            while (i < count)
+            {
+                if (subscribers[i] == rhs)
+                {
+                    RemoveAt(i);
+                }
+                else
+                {
+                    i++;
+                }
+            }
+            return *this;
+        }
+
+        /**
+         * @brief           Remove all subscribed functions and saved parameters, invalidating every handle.
+         */
+        void Clear()
+        {
+            ClearSaved();
+            for (size_t i = 0; i < count; i++)
+            {
+                subscribers[i].Reset();
+                Release(owners[i]);
+            }
+            count = 0;
+        }
+
+    private:
+        SubscriptionHandle Overflowed() const
+        {
+            switch (Overflow)
+            {
+            case InlineOverflow::Assert:
+                assert(!"InlineDelegate capacity exceeded");
+                break;
+            case InlineOverflow::Terminate:
+                std::terminate();
+            case InlineOverflow::Reject:
+                break;
+            }
+            return SubscriptionHandle{UINT32_MAX, 0};
+        }
+
+        void RemoveAt(size_t position)
+        {
+            uint32_t slot = owners[position];
+            for (size_t i = position + 1; i < count; i++)
+            {
+                subscribers[i - 1] = std::move(subscribers[i]);
+                owners[i - 1] = owners[i];
+                positions[owners[i - 1]] = static_cast<uint32_t>(i - 1);
+            }
+            count--;
+            subscribers[count].Reset();
+
+            for (size_t i = 0; i < savedCount; i++)
+            {
+                if (Saved(i).owner.index == slot)
+                {
+                    for (size_t j = i + 1; j < savedCount; j++)
+                    {
+                        Saved(j - 1) = std::move(Saved(j));
+                    }
+                    savedCount--;
+                    Saved(savedCount).~SavedCall();
+                    break;
+                }
+            }
+            Release(slot);
+        }
+
+        void Release(uint32_t slot)
+        {
+            used[slot] = false;
+            generations[slot]++;
+        }
+
+        void ClearSaved()
+        {
+            for (size_t i = 0; i < savedCount; i++)
+            {
+                Saved(i).~SavedCall();
+            }
+            savedCount = 0;
+        }
+
+        void CopyFrom(const BasicInlineDelegate &other)
+        {
+            count = other.count;
+            for (size_t i = 0; i < Capacity; i++)
+            {
+                subscribers[i] = other.subscribers[i];
+                owners[i] = other.owners[i];
+                positions[i] = other.positions[i];
+                used[i] = other.used[i];
+                generations[i] = other.generations[i];
+            }
+            for (size_t i = 0; i < other.savedCount; i++)
+            {
+                ::new (static_cast<void *>(&saved[i])) SavedCall(other.Saved(i));
+            }
+            savedCount = other.savedCount;
+        }
+
+        SavedCall &Saved(size_t i) { return *reinterpret_cast<SavedCall *>(&saved[i]); }
+        const SavedCall &Saved(size_t i) const { return *reinterpret_cast<const SavedCall *>(&saved[i]); }
+
+        ReturnType Invoke(std::true_type) const
+        {
+            for (size_t i = 0; i < savedCount; i++)
+            {
+                CallSaved(Saved(i), Sequence());
+            }
+        }
+
+        ReturnType Invoke(std::false_type) const
+        {
+            ReturnType result = ReturnType();
+            for (size_t i = 0; i < savedCount; i++)
+            {
+                result += CallSaved(Saved(i), Sequence());
+            }
+            return result;
+        }
+
+        template <size_t... Indices>
+        ReturnType CallSaved(const SavedCall &call, std::index_sequence<Indices...>) const
+        {
+            return subscribers[positions[call.owner.index]].CallShared(ParameterColumn<Params>::Load(std::get<Indices>(call.arguments))...);
+        }
+
+        /**
+         * @brief           Parameter *value* as rvalue to be moved into the saved pack, or as lvalue if it is a reference.
+         */
+        template <typename T>
+        static typename std::conditional<std::is_reference<T>::value, T &, T &&>::type Moved(T &value)
+        {
+            return static_cast<typename std::conditional<std::is_reference<T>::value, T &, T &&>::type>(value);
+        }
+
+        ReturnType Call(std::true_type, ArgumentType<Params>... params) const
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                subscribers[i].CallShared(params...);
+            }
+        }
+
+        ReturnType Call(std::false_type, ArgumentType<Params>... params) const
+        {
+            return (*this)(SumResults<ReturnType>(), params...);
+        }
+
+        FunctionType subscribers[Capacity];
+        uint32_t owners[Capacity] = {};
+
+        /**
+         * @brief           Position in ***subscribers*** of the subscription of each slot.
+         */
+        uint32_t positions[Capacity] = {};
+        uint32_t generations[Capacity] = {};
+        bool used[Capacity] = {};
+        uint32_t count = 0;
+        uint32_t savedCount = 0;
+        typename std::aligned_storage<sizeof(SavedCall), alignof(SavedCall)>::type saved[Capacity];
+    };
+
+    /**
+     * @brief  InlineDelegate of void functions, asserting on overflow in debug builds (see BasicInlineDelegate).
+     */
+    template <size_t Capacity, typename... Params>
+    using InlineDelegate = BasicInlineDelegate<Capacity, InlineOverflow::Assert, void, Params...>;
+
+    /**
+     * @brief  InlineDelegate of functions returning *ReturnType*, asserting on overflow in debug builds.
+     */
+    template <size_t Capacity, typename ReturnType, typename... Params>
+    using InlineRetDelegate = BasicInlineDelegate<Capacity, InlineOverflow::Assert, ReturnType, Params...>;
+} // namespace dw
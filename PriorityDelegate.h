@@ -0,0 +1,323 @@
+#pragma once
+
+#include "Delegate.h"
+
+namespace dw
+{
+    /**
+     * @brief  Priority of a subscription: higher values are called first.
+     */
+    struct Priority
+    {
+        int value = 0;
+    };
+
+    /**
+     * @brief  Delegate calling its subscribers by descending priority, in subscription order within equal priorities.
+     * @note   The subscribers stay one contiguous vector sorted by priority, so invocation is the same linear scan as
+     *         SimpleDelegate's. New subscriptions are appended in O(1) past the sorted part and merged into it once, by
+     *         the next invocation: the k new entries are stable sorted in reused scratch buffers, then merged in place
+     *         from the back, so only the entries of lower priority than the new ones move. Subscribing at the lowest
+     *         priority costs no move at all, and a batch moves each displaced entry once instead of k times.
+     *         Unsubscribing by handle is O(1) and leaves an empty entry, dropped once removed entries take half of
+     *         the vector.
+     *         Like SimpleDelegate, subscribers must not modify it while it is being called.
+     * @tparam Allocator    Allocator of the subscribers.
+     * @tparam ReturnType   Return type of the subscribed functions.
+     * @tparam Params       Any number of arguments of any type.
+     */
+    template <typename Allocator, typename ReturnType, typename... Params>
+    class BasicPriorityDelegate : public SimpleDelegateBase<Allocator, ReturnType, Params...>
+    {
+    public:
+        using Parent = SimpleDelegateBase<Allocator, ReturnType, Params...>;
+        using Parent::slots;
+        using Parent::subscribers;
+        using Parent::subscriberSlots;
+        using typename Parent::FunctionType;
+
+        BasicPriorityDelegate() = default;
+        explicit BasicPriorityDelegate(const Allocator &allocator)
+            : Parent(allocator), priorities(allocator), ranks(allocator), order(allocator), pending(allocator)
+        {
+        }
+
+        /**
+         * @brief           Invoke all subscribed functions by descending priority.
+         *
+         * @param  params:  Arguments of each subscribed function.
+         * @returns         Sum of their results, if *ReturnType* is not void.
+         */
+        ReturnType operator()(ArgumentType<Params>... params)
+        {
+            return Call(std::is_void<ReturnType>(), params...);
+        }
+
+        /**
+         * @brief           Invoke all subscribed functions by descending priority, combining their results.
+         *
+         * @param  combiner:    Result combiner (see SumResults), may stop the invocation early.
+         * @param  params:      Arguments of each subscribed function.
+         * @returns         Combined result.
+         */
+        template <typename Combiner, typename = typename std::enable_if<IsCombiner<Combiner, ReturnType>::value>::type>
+        typename Combiner::ResultType operator()(Combiner combiner, ArgumentType<Params>... params)
+        {
+            Merge();
+            for (auto &&i : subscribers)
+            {
+                if (i && !combiner(i.CallShared(params...)))
+                {
+                    break;
+                }
+            }
+            return combiner.Result();
+        }
+
+        /**
+         * @brief           Subscribe *function* with *priority*, after the subscribers of the same priority.
+         *
+         * @param  function:    Function to subscribe.
+         * @param  priority:    Higher priorities are called first.
+         * @returns         Handle that unsubscribes exactly this subscription with Unsubscribe().
+         */
+        SubscriptionHandle Subscribe(const FunctionType &function, Priority priority)
+        {
+            SubscriptionHandle handle = this->AddSubscriber(function);
+            if (handle.index >= priorities.size())
+            {
+                priorities.resize(handle.index + 1);
+            }
+            priorities[handle.index] = priority.value;
+            ranks.push_back(priority.value);
+            return handle;
+        }
+
+        /**
+         * @brief           Subscribe *function* with *priority* for the lifetime of the returned connection.
+         *
+         * @param  function:    Function to subscribe.
+         * @param  priority:    Higher priorities are called first.
+         * @returns         Connection unsubscribing the function when destroyed.
+         */
+        ScopedConnection Connect(const FunctionType &function, Priority priority)
+        {
+            return ScopedConnection(*this, Subscribe(function, priority));
+        }
+
+        /**
+         * @brief           Unsubscribe the subscription of *handle* in O(1).
+         *
+         * @param  handle:  Handle returned on subscription.
+         * @returns         true if the subscription existed.
+         */
+        bool Unsubscribe(SubscriptionHandle handle)
+        {
+            if (!this->ReleaseSubscriber(handle))
+            {
+                return false;
+            }
+            if (this->NeedsCompaction())
+            {
+                Compact();
+            }
+            return true;
+        }
+
+        /**
+         * @returns         Priority of the subscription of *handle*, default priority if it was removed.
+         */
+        Priority PriorityOf(SubscriptionHandle handle) const
+        {
+            return this->IsSubscribed(handle) ? Priority{priorities[handle.index]} : Priority{};
+        }
+
+        /**
+         * @brief           Subscribe function to this delegate with the default priority.
+         *
+         * @param  rhs:     Function to subscribe.
+         * @returns         Reference to the delegate instance.
+         */
+        BasicPriorityDelegate &operator+=(const FunctionType &rhs)
+        {
+            Subscribe(rhs, Priority{});
+            return *this;
+        }
+
+        /**
+         * @brief           Unsubscribe choosen function from this delegate.
+         *
+         * @param  rhs:     Function to unsubscribe from this delegate.
+         * @returns         Reference to the delegate instance.
+         */
+        BasicPriorityDelegate &operator-=(const FunctionType &rhs)
+        {
+            Merge();
+            this->RemoveSubscribersIf([&](size_t i) { return subscribers[i] == rhs; });
+            UpdateRanks();
+            return *this;
+        }
+
+        /**
+         * @brief           Remove all subscribed functions from this delegate.
+         */
+        void Clear()
+        {
+            this->ClearSubscribers();
+            ranks.clear();
+            sorted = 0;
+        }
+
+    private:
+        /**
+         * @brief           Subscriber appended since the last merge, waiting to be merged.
+         */
+        struct Pending
+        {
+            FunctionType function;
+            uint32_t slot;
+            int rank;
+        };
+
+        /**
+         * @brief           Stable sort the subscribers appended since the last merge and merge them into the sorted
+         *                  ones, from the back. Removed entries are merged as well, by the priority they had.
+         */
+        void Merge()
+        {
+            size_t size = subscribers.size();
+            if (sorted == size)
+            {
+                return;
+            }
+
+            order.clear();
+            for (size_t i = sorted; i < size; ++i)
+            {
+                order.push_back(static_cast<uint32_t>(i));
+            }
+            std::stable_sort(order.begin(), order.end(), [this](uint32_t lhs, uint32_t rhs) { return ranks[lhs] > ranks[rhs]; });
+
+            pending.clear();
+            for (uint32_t i : order)
+            {
+                pending.push_back(Pending{std::move(subscribers[i]), subscriberSlots[i], ranks[i]});
+            }
+
+            // Fill the vector from its end: the sorted entries of lower priority than the next new one move past it,
+            // the ones of higher or equal priority stay where they are.
+            size_t next = sorted;
+            size_t position = size;
+            for (size_t i = pending.size(); i > 0;)
+            {
+                --position;
+                if (next > 0 && ranks[next - 1] < pending[i - 1].rank)
+                {
+                    --next;
+                    Place(position, std::move(subscribers[next]), subscriberSlots[next], ranks[next]);
+                }
+                else
+                {
+                    --i;
+                    Place(position, std::move(pending[i].function), pending[i].slot, pending[i].rank);
+                }
+            }
+            sorted = size;
+        }
+
+        void Place(size_t position, FunctionType &&function, uint32_t slot, int rank)
+        {
+            subscribers[position] = std::move(function);
+            subscriberSlots[position] = slot;
+            ranks[position] = rank;
+            if (slot != Parent::NoSlot)
+            {
+                slots[slot].position = static_cast<uint32_t>(position);
+            }
+        }
+
+        /**
+         * @brief           Merge the new subscribers, then drop removed entries.
+         */
+        void Compact()
+        {
+            Merge();
+            this->CompactSubscribers();
+            UpdateRanks();
+        }
+
+        /**
+         * @brief           Rebuild the priority of each entry after the subscribers were compacted, all sorted.
+         */
+        void UpdateRanks()
+        {
+            ranks.resize(subscribers.size());
+            for (size_t i = 0; i < subscribers.size(); ++i)
+            {
+                ranks[i] = priorities[subscriberSlots[i]];
+            }
+            sorted = subscribers.size();
+        }
+
+        ReturnType Call(std::true_type, ArgumentType<Params>... params)
+        {
+            Merge();
+            for (auto &&i : subscribers)
+            {
+                if (i)
+                {
+                    i.CallShared(params...);
+                }
+            }
+        }
+
+        ReturnType Call(std::false_type, ArgumentType<Params>... params)
+        {
+            return (*this)(SumResults<ReturnType>(), params...);
+        }
+
+        /**
+         * @brief           Priority of each subscription, indexed by SubscriptionHandle::index.
+         */
+        AllocatorVector<int, Allocator> priorities;
+
+        /**
+         * @brief           Priority of each entry of ***subscribers***, removed entries included.
+         */
+        AllocatorVector<int, Allocator> ranks;
+
+        /**
+         * @brief           Scratch buffers of Merge(), kept to reuse their capacity.
+         */
+        AllocatorVector<uint32_t, Allocator> order;
+        AllocatorVector<Pending, Allocator> pending;
+
+        /**
+         * @brief           Count of leading subscribers already sorted by priority.
+         */
+        size_t sorted = 0;
+    };
+
+    /**
+     * @brief  BasicPriorityDelegate of void functions using the default allocator.
+     */
+    template <typename... Params>
+    using PriorityDelegate = BasicPriorityDelegate<DefaultAllocator, void, Params...>;
+
+    /**
+     * @brief  BasicPriorityDelegate of functions returning *ReturnType*, using the default allocator.
+     */
+    template <typename ReturnType, typename... Params>
+    using PriorityRetDelegate = BasicPriorityDelegate<DefaultAllocator, ReturnType, Params...>;
+
+#if DW_HAS_PMR
+    namespace pmr
+    {
+        template <typename... Params>
+        using PriorityDelegate = BasicPriorityDelegate<Allocator, void, Params...>;
+
+        template <typename ReturnType, typename... Params>
+        using PriorityRetDelegate = BasicPriorityDelegate<Allocator, ReturnType, Params...>;
+    } // namespace pmr
+#endif
+} // namespace dw
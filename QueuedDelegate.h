@@ -0,0 +1,280 @@
+#pragma once
+
+#include "Delegate.h"
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+namespace dw
+{
+    /**
+     * @brief  What QueuedDelegate::Post() does when the queue is full.
+     */
+    enum class QueueFullPolicy
+    {
+        Block,     ///< Wait (yielding) until the consumer frees a cell.
+        Drop,      ///< Discard the posted arguments.
+        Overwrite  ///< Discard the oldest queued arguments to make room.
+    };
+
+    /**
+     * @brief  Delegate whose calls are posted from any number of threads and run later by a consumer thread.
+     * @note   Posted arguments are copied into a bounded lock-free ring (Vyukov's bounded queue: one sequence number
+     *         per cell, one atomic position per side), allocated once on construction, so posting never allocates.
+     *         References are posted as values. Subscribing, unsubscribing and draining belong to the consumer thread.
+     * @tparam Allocator    Allocator of the ring and the subscribers.
+     * @tparam Params       Any number of arguments of any type.
+     */
+    template <typename Allocator, typename... Params>
+    class BasicQueuedDelegate : public BasicSimpleDelegate<Allocator, Params...>
+    {
+    public:
+        using Parent = BasicSimpleDelegate<Allocator, Params...>;
+        using Parent::subscribers;
+        using typename Parent::FunctionType;
+
+    private:
+        using Arguments = std::tuple<typename std::decay<Params>::type...>;
+        using Sequence = std::index_sequence_for<Params...>;
+
+        struct Cell
+        {
+            std::atomic<size_t> sequence;
+            typename std::aligned_storage<sizeof(Arguments), alignof(Arguments)>::type storage;
+
+            Arguments &Value() { return *reinterpret_cast<Arguments *>(&storage); }
+        };
+
+    public:
+        /**
+         * @param  capacity:    Count of argument packs the queue holds, rounded up to a power of two (at least 2).
+         * @param  policy:      Behavior of Post() when the queue is full.
+         * @param  allocator:   Allocator of the ring and the subscribers.
+         */
+        explicit BasicQueuedDelegate(size_t capacity, QueueFullPolicy policy = QueueFullPolicy::Block, const Allocator &allocator = Allocator())
+            : Parent(allocator), mask(RoundCapacity(capacity) - 1), cells(mask + 1, allocator), policy(policy)
+        {
+            for (size_t i = 0; i <= mask; i++)
+            {
+                cells[i].sequence.store(i, std::memory_order_relaxed);
+            }
+        }
+
+        BasicQueuedDelegate(const BasicQueuedDelegate &) = delete;
+        BasicQueuedDelegate &operator=(const BasicQueuedDelegate &) = delete;
+
+        ~BasicQueuedDelegate()
+        {
+            Discard();
+        }
+
+        /**
+         * @brief           Queue a call of the subscribers with *params*. Thread-safe, lock-free unless blocking.
+         * @note            Blocking on the consumer thread deadlocks if the queue is full.
+         *
+         * @param  params:  Arguments of each subscribed function, copied into the queue.
+         * @returns         false if the arguments were dropped because the queue was full.
+         */
+        bool Post(ArgumentType<Params>... params)
+        {
+            for (;;)
+            {
+                if (TryEnqueue(std::forward<ArgumentType<Params>>(params)...))
+                {
+                    return true;
+                }
+
+                switch (policy)
+                {
+                case QueueFullPolicy::Block:
+                    std::this_thread::yield();
+                    break;
+                case QueueFullPolicy::Drop:
+                    dropped.fetch_add(1, std::memory_order_relaxed);
+                    return false;
+                case QueueFullPolicy::Overwrite:
+                    if (TryDequeue(1, [](Arguments &) {}))
+                    {
+                        dropped.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    else
+                    {
+                        // Every cell is claimed by a drain in progress.
+                        std::this_thread::yield();
+                    }
+                    break;
+                }
+            }
+        }
+
+        /**
+         * @brief           Call the subscribers with the queued argument packs, in posting order.
+         * @note            Claims all ready packs with a single atomic operation; packs posted meanwhile are left for
+         *                  the next call.
+         *
+         * @param  max:     Maximum count of packs to process.
+         * @returns         Count of processed packs.
+         */
+        size_t Drain(size_t max = SIZE_MAX)
+        {
+            return TryDequeue(max, [this](Arguments &arguments) { Call(arguments, Sequence()); });
+        }
+
+        /**
+         * @brief           Discard the queued argument packs without calling the subscribers.
+         * @returns         Count of discarded packs.
+         */
+        size_t Discard()
+        {
+            return TryDequeue(SIZE_MAX, [](Arguments &) {});
+        }
+
+        /**
+         * @returns         Approximate count of queued argument packs.
+         */
+        size_t Pending() const
+        {
+            size_t head = dequeuePosition.load(std::memory_order_relaxed);
+            size_t tail = enqueuePosition.load(std::memory_order_relaxed);
+            return tail > head ? tail - head : 0;
+        }
+
+        /**
+         * @returns         Count of argument packs the queue holds.
+         */
+        size_t Capacity() const { return mask + 1; }
+
+        /**
+         * @returns         Count of argument packs dropped or overwritten because the queue was full.
+         */
+        size_t Dropped() const { return dropped.load(std::memory_order_relaxed); }
+
+    private:
+        static size_t RoundCapacity(size_t capacity)
+        {
+            size_t rounded = 2;
+            while (rounded < capacity)
+            {
+                rounded <<= 1;
+            }
+            return rounded;
+        }
+
+        bool TryEnqueue(ArgumentType<Params>... params)
+        {
+            size_t position = enqueuePosition.load(std::memory_order_relaxed);
+            Cell *cell;
+            for (;;)
+            {
+                cell = &cells[position & mask];
+                intptr_t difference = static_cast<intptr_t>(cell->sequence.load(std::memory_order_acquire)) - static_cast<intptr_t>(position);
+                if (difference == 0)
+                {
+                    if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (difference < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    position = enqueuePosition.load(std::memory_order_relaxed);
+                }
+            }
+
+            ::new (static_cast<void *>(&cell->storage)) Arguments(params...);
+            cell->sequence.store(position + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief           Claim up to *max* consecutive ready packs at once, pass each to *consume* and free its cell.
+         */
+        template <typename Consume>
+        size_t TryDequeue(size_t max, const Consume &consume)
+        {
+            size_t position = dequeuePosition.load(std::memory_order_relaxed);
+            size_t count;
+            for (;;)
+            {
+                count = 0;
+                while (count < max && count <= mask &&
+                       cells[(position + count) & mask].sequence.load(std::memory_order_acquire) == position + count + 1)
+                {
+                    count++;
+                }
+                if (count == 0)
+                {
+                    intptr_t difference = static_cast<intptr_t>(cells[position & mask].sequence.load(std::memory_order_acquire)) - static_cast<intptr_t>(position + 1);
+                    if (difference < 0)
+                    {
+                        return 0;
+                    }
+                    position = dequeuePosition.load(std::memory_order_relaxed);
+                    continue;
+                }
+                if (dequeuePosition.compare_exchange_weak(position, position + count, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+
+            for (size_t i = 0; i < count; i++)
+            {
+                Cell &cell = cells[(position + i) & mask];
+                consume(cell.Value());
+                cell.Value().~Arguments();
+                cell.sequence.store(position + i + mask + 1, std::memory_order_release);
+            }
+            return count;
+        }
+
+        template <size_t... Indices>
+        void Call(Arguments &arguments, std::index_sequence<Indices...>)
+        {
+            (void)arguments;
+            for (auto &&i : subscribers)
+            {
+                if (i)
+                {
+                    i.CallShared(Pass<Params>(std::get<Indices>(arguments))...);
+                }
+            }
+        }
+
+        /**
+         * @brief           Pass a queued argument as lvalue to every subscriber, or as rvalue for *T&&* parameters.
+         */
+        template <typename T, typename Value>
+        static typename std::conditional<std::is_rvalue_reference<T>::value, Value &&, Value &>::type Pass(Value &value)
+        {
+            return static_cast<typename std::conditional<std::is_rvalue_reference<T>::value, Value &&, Value &>::type>(value);
+        }
+
+        const size_t mask;
+        AllocatorVector<Cell, Allocator> cells;
+        const QueueFullPolicy policy;
+        std::atomic<size_t> dropped{0};
+
+        alignas(64) std::atomic<size_t> enqueuePosition{0};
+        alignas(64) std::atomic<size_t> dequeuePosition{0};
+    };
+
+    /**
+     * @brief  BasicQueuedDelegate using the default allocator.
+     */
+    template <typename... Params>
+    using QueuedDelegate = BasicQueuedDelegate<DefaultAllocator, Params...>;
+
+#if DW_HAS_PMR
+    namespace pmr
+    {
+        template <typename... Params>
+        using QueuedDelegate = BasicQueuedDelegate<Allocator, Params...>;
+    } // namespace pmr
+#endif
+} // namespace dw
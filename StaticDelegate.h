@@ -0,0 +1,165 @@
+#pragma once
+
+#include "Delegate.h"
+
+#if !defined(__cpp_fold_expressions) || !defined(__cpp_nontype_template_parameter_auto)
+#error "StaticDelegate.h requires C++17."
+#endif
+
+namespace dw
+{
+    /**
+     * @brief  Delegate whose subscribers are the functors *Functors*, fixed at compile time.
+     * @note   operator() expands into one direct call per functor (fold expression), so the compiler can inline
+     *         every one of them: there is no subscriber storage and no indirect call. Stateless functors take no room.
+     *         Offers the calling surface of Delegate (void *ReturnType*) or RetDelegate (any other *ReturnType*).
+     * @tparam Signature    Function type of the subscribers, *ReturnType(Params...)*.
+     * @tparam Functors     Types of the subscribed functors, called in order.
+     */
+    template <typename Signature, typename... Functors>
+    class StaticFunctorDelegate;
+
+    template <typename ReturnType, typename... Params, typename... Functors>
+    class StaticFunctorDelegate<ReturnType(Params...), Functors...>
+    {
+    public:
+        StaticFunctorDelegate() = default;
+        explicit StaticFunctorDelegate(Functors... functors) : functors(std::move(functors)...) {}
+
+        /**
+         * @returns         Count of subscribed functors.
+         */
+        static constexpr size_t Count() { return sizeof...(Functors); }
+
+        /**
+         * @brief           Call every functor.
+         *
+         * @param  params:  Arguments of each functor.
+         * @returns         Nothing for void *ReturnType*, otherwise the sum of their results.
+         */
+        ReturnType operator()(ArgumentType<Params>... params) const
+        {
+            if constexpr (std::is_void<ReturnType>::value)
+            {
+                CallAll(Sequence(), params...);
+            }
+            else
+            {
+                return (*this)(SumResults<ReturnType>(), params...);
+            }
+        }
+
+        /**
+         * @brief           Call the functors in order, combining their results.
+         *
+         * @param  combiner:    Result combiner (see SumResults), may stop the invocation early.
+         * @param  params:      Arguments of each functor.
+         * @returns         Combined result.
+         */
+        template <typename Combiner, typename = typename std::enable_if<IsCombiner<Combiner, ReturnType>::value>::type>
+        typename Combiner::ResultType operator()(Combiner combiner, ArgumentType<Params>... params) const
+        {
+            Combine(combiner, Sequence(), params...);
+            return combiner.Result();
+        }
+
+        /**
+         * @brief           Call the functors until one returns a result satisfying *predicate*.
+         * @returns         true if a functor returned a result satisfying *predicate*.
+         */
+        template <typename Predicate>
+        bool CallUntil(Predicate predicate, ArgumentType<Params>... params) const
+        {
+            return (*this)(UntilResult<ReturnType, Predicate>(std::move(predicate)), params...);
+        }
+
+        /**
+         * @brief           Call the functors until one returns true.
+         * @returns         true if any functor returned true.
+         */
+        bool AnyOf(ArgumentType<Params>... params) const
+        {
+            return (*this)(AnyResult(), params...);
+        }
+
+        /**
+         * @brief           Call the functors until one returns false.
+         * @returns         true if all functors returned true (or there is none).
+         */
+        bool AllOf(ArgumentType<Params>... params) const
+        {
+            return (*this)(AllResults(), params...);
+        }
+
+    private:
+        using Sequence = std::index_sequence_for<Functors...>;
+
+        template <size_t... Indices>
+        void CallAll(std::index_sequence<Indices...>, ArgumentType<Params>... params) const
+        {
+            (std::get<Indices>(functors)(params...), ...);
+        }
+
+        template <typename Combiner, size_t... Indices>
+        void Combine(Combiner &combiner, std::index_sequence<Indices...>, ArgumentType<Params>... params) const
+        {
+            // && stops the expansion at the first functor whose result makes the combiner stop.
+            (void)(true && ... && static_cast<bool>(combiner(std::get<Indices>(functors)(params...))));
+        }
+
+        std::tuple<Functors...> functors;
+    };
+
+    /**
+     * @brief           Make a StaticFunctorDelegate of signature *Signature* calling *functors* (e.g. lambdas) in order.
+     * @note            Usage: `auto del = MakeStaticDelegate<void(int)>([](int) { ... }, [&](int) { ... });`
+     */
+    template <typename Signature, typename... Functors>
+    StaticFunctorDelegate<Signature, typename std::decay<Functors>::type...> MakeStaticDelegate(Functors &&...functors)
+    {
+        return StaticFunctorDelegate<Signature, typename std::decay<Functors>::type...>(std::forward<Functors>(functors)...);
+    }
+
+    /**
+     * @brief  Empty functor calling the function *Function* directly.
+     */
+    template <auto Function>
+    struct StaticFunction
+    {
+        template <typename... Args>
+        decltype(auto) operator()(Args &&...args) const
+        {
+            return Function(std::forward<Args>(args)...);
+        }
+    };
+
+    /**
+     * @brief  Function type *ReturnType(Params...)* of a function pointer type.
+     */
+    template <typename Function>
+    struct FunctionSignature;
+
+    template <typename ReturnType, typename... Params>
+    struct FunctionSignature<ReturnType (*)(Params...)>
+    {
+        using Type = ReturnType(Params...);
+    };
+
+    template <typename ReturnType, typename... Params>
+    struct FunctionSignature<ReturnType (*)(Params...) noexcept>
+    {
+        using Type = ReturnType(Params...);
+    };
+
+    /**
+     * @brief  Delegate whose subscribers are the functions *First, Rest...*, fixed at compile time.
+     * @note   Usage: `StaticDelegate<&OnHit, &PlaySound, &Log> onHit; onHit(hit);`. Every call is direct and can be
+     *         inlined. The signature is the one of *First*; the other functions must accept its parameters.
+     *         See StaticFunctorDelegate for the calling surface.
+     */
+    template <auto First, auto... Rest>
+    class StaticDelegate
+        : public StaticFunctorDelegate<typename FunctionSignature<decltype(First)>::Type, StaticFunction<First>, StaticFunction<Rest>...>
+    {
+    };
+} // namespace dw
@@ -0,0 +1,293 @@
+#pragma once
+
+#include "Delegate.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace dw
+{
+    /**
+     * @brief  Work-stealing thread pool, usable as the executor of ParallelPolicy and of the InvokeParallel() and InvokeAsync() methods.
+     * @note   Tasks are Callable<void> objects, so queuing one never allocates beyond the queue itself.
+     *         ParallelFor() splits its range into chunks and deals them out in contiguous blocks to per-worker queues.
+     *         Workers take chunks from the front of their own queue and steal from the back of the others when it runs dry.
+     *         The calling thread helps running chunks until all of them completed, so ParallelFor() may also be
+     *         called from inside a chunk.
+     */
+    class ThreadPool
+    {
+    private:
+        /**
+         * @brief           State of one ParallelFor() call, living on the stack of its caller.
+         */
+        struct Job
+        {
+            void (*run)(const void *body, size_t begin, size_t end);
+            const void *body;
+            size_t count;
+            size_t grain;
+            std::atomic<size_t> pending;
+            std::mutex mutex;
+            std::condition_variable finished;
+            bool done = false;
+        };
+
+        using Task = Callable<void>;
+
+        struct alignas(64) Queue
+        {
+            std::mutex mutex;
+            std::deque<Task> tasks;
+        };
+
+    public:
+        /**
+         * @param  threadCount: Count of worker threads, the calling thread of ParallelFor() helps them.
+         */
+        explicit ThreadPool(size_t threadCount = DefaultThreadCount())
+            : queues(threadCount ? threadCount : 1)
+        {
+            workers.reserve(queues.size());
+            for (size_t i = 0; i < queues.size(); ++i)
+            {
+                workers.emplace_back([this, i] { Work(i); });
+            }
+        }
+
+        ThreadPool(const ThreadPool &) = delete;
+        ThreadPool &operator=(const ThreadPool &) = delete;
+
+        /**
+         * @brief           Run the tasks still queued, then join the workers.
+         */
+        ~ThreadPool()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                stop = true;
+            }
+            wake.notify_all();
+            for (auto &worker : workers)
+            {
+                worker.join();
+            }
+        }
+
+        /**
+         * @returns         Count of worker threads.
+         */
+        size_t Size() const { return workers.size(); }
+
+        /**
+         * @brief           Call *body(begin, end)* for chunks of *grain* indices covering [0, count), in parallel.
+         *                  Returns once every chunk completed.
+         *
+         * @param  count:   Count of indices.
+         * @param  grain:   Count of indices per chunk, 0 picks about four chunks per thread.
+         * @param  body:    Callable invoked with the bounds of each chunk.
+         */
+        template <typename Body>
+        void ParallelFor(size_t count, size_t grain, const Body &body)
+        {
+            if (count == 0)
+            {
+                return;
+            }
+
+            size_t threads = queues.size() + 1;
+            if (grain == 0)
+            {
+                grain = std::max<size_t>(1, count / (threads * 4));
+            }
+            size_t chunks = (count + grain - 1) / grain;
+            if (chunks == 1)
+            {
+                body(0, count);
+                return;
+            }
+
+            Job job;
+            job.run = [](const void *context, size_t begin, size_t end) { (*static_cast<const Body *>(context))(begin, end); };
+            job.body = &body;
+            job.count = count;
+            job.grain = grain;
+            job.pending.store(chunks, std::memory_order_relaxed);
+
+            for (size_t q = 0; q < queues.size(); ++q)
+            {
+                size_t first = chunks * q / queues.size();
+                size_t last = chunks * (q + 1) / queues.size();
+                if (first == last)
+                {
+                    continue;
+                }
+
+                Job *target = &job;
+                std::lock_guard<std::mutex> lock(queues[q].mutex);
+                for (size_t c = first; c < last; ++c)
+                {
+                    queues[q].tasks.push_back(Task([target, c] { RunChunk(*target, c); }));
+                }
+            }
+            queued.fetch_add(chunks);
+            Wake(true);
+
+            Task task;
+            while (job.pending.load(std::memory_order_acquire) != 0 && TakeTask(CurrentQueue(), task))
+            {
+                task();
+            }
+
+            std::unique_lock<std::mutex> lock(job.mutex);
+            job.finished.wait(lock, [&job] { return job.done; });
+        }
+
+        /**
+         * @brief           Queue *task* to run on a worker thread.
+         * @note            Queued on the calling worker's own queue, or dealt out round-robin from other threads.
+         */
+        void Post(Task task)
+        {
+            size_t q = CurrentQueue();
+            if (q == queues.size())
+            {
+                q = nextQueue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+            }
+            {
+                std::lock_guard<std::mutex> lock(queues[q].mutex);
+                queues[q].tasks.push_back(std::move(task));
+            }
+            queued.fetch_add(1);
+            Wake(false);
+        }
+
+        /**
+         * @returns         Count of hardware threads minus the calling thread (at least 1).
+         */
+        static size_t DefaultThreadCount()
+        {
+            unsigned hardware = std::thread::hardware_concurrency();
+            return hardware > 1 ? hardware - 1 : 1;
+        }
+
+    private:
+        void Work(size_t index)
+        {
+            Current() = {this, index};
+
+            Task task;
+            for (;;)
+            {
+                if (TakeTask(index, task))
+                {
+                    task();
+                    task.Reset();
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock, [this] { return stop || queued.load() != 0; });
+                if (stop && queued.load() == 0)
+                {
+                    return;
+                }
+            }
+        }
+
+        /**
+         * @brief           Pop a task from the front of queue *own* (if valid), or steal one from the back of another queue.
+         */
+        bool TakeTask(size_t own, Task &task)
+        {
+            size_t count = queues.size();
+            for (size_t i = 0; i < count; ++i)
+            {
+                size_t q = own < count ? (own + i) % count : i;
+                Queue &queue = queues[q];
+
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                if (queue.tasks.empty())
+                {
+                    continue;
+                }
+                if (q == own)
+                {
+                    task = std::move(queue.tasks.front());
+                    queue.tasks.pop_front();
+                }
+                else
+                {
+                    task = std::move(queue.tasks.back());
+                    queue.tasks.pop_back();
+                }
+
+                queued.fetch_sub(1);
+                return true;
+            }
+            return false;
+        }
+
+        void Wake(bool all)
+        {
+            {
+                // Workers check *queued* under the mutex before sleeping: taking it here orders the wake-up after that check.
+                std::lock_guard<std::mutex> lock(mutex);
+            }
+            if (all)
+            {
+                wake.notify_all();
+            }
+            else
+            {
+                wake.notify_one();
+            }
+        }
+
+        static void RunChunk(Job &job, size_t chunk)
+        {
+            job.run(job.body, chunk * job.grain, std::min(job.count, (chunk + 1) * job.grain));
+
+            if (job.pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                std::lock_guard<std::mutex> lock(job.mutex);
+                job.done = true;
+                job.finished.notify_all();
+            }
+        }
+
+        struct Worker
+        {
+            const ThreadPool *pool;
+            size_t index;
+        };
+
+        static Worker &Current()
+        {
+            thread_local Worker worker{nullptr, 0};
+            return worker;
+        }
+
+        /**
+         * @returns         Queue of the calling thread if it is a worker of this pool, an invalid index otherwise.
+         */
+        size_t CurrentQueue() const
+        {
+            return Current().pool == this ? Current().index : queues.size();
+        }
+
+        std::vector<Queue> queues;
+        std::vector<std::thread> workers;
+
+        std::mutex mutex;
+        std::condition_variable wake;
+        std::atomic<size_t> queued{0};
+        std::atomic<size_t> nextQueue{0};
+        bool stop = false;
+    };
+} // namespace dw
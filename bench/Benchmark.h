@@ -0,0 +1,128 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace dw
+{
+    namespace bench
+    {
+        /**
+         * @brief           Prevent the compiler from optimizing away the computation of *value*.
+         */
+        template <typename T>
+        inline void DoNotOptimize(const T &value)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            asm volatile("" : : "r,m"(value) : "memory");
+#else
+            static volatile const void *sink;
+            sink = &value;
+#endif
+        }
+
+        /**
+         * @brief           Prevent the compiler from caching memory across this point.
+         */
+        inline void ClobberMemory()
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            asm volatile("" : : : "memory");
+#endif
+        }
+
+        /**
+         * @brief           Minimal self-contained benchmark runner.
+         * @note            Each benchmark is a callable running one operation. The runner grows the iteration count
+         *                  until a batch takes at least *minTime*, then reports the best of *repetitions* batches.
+         */
+        class Runner
+        {
+        public:
+            Runner(int argc, char **argv)
+            {
+                for (int i = 1; i < argc; ++i)
+                {
+                    if (std::strcmp(argv[i], "--quick") == 0)
+                    {
+                        minTime = std::chrono::milliseconds(5);
+                        repetitions = 1;
+                    }
+                    else
+                    {
+                        filter = argv[i];
+                    }
+                }
+                std::printf("%-56s %12s %14s %12s\n", "Benchmark", "Subscribers", "ns/op", "ns/call");
+            }
+
+            /**
+             * @brief           Measure *operation* and print one result line.
+             *
+             * @param  name:        Benchmark name, matched against the command line filter.
+             * @param  calls:       Count of handler calls performed by one operation (used for the ns/call column).
+             * @param  operation:   Callable running a single operation.
+             */
+            template <typename Operation>
+            void Run(const std::string &name, size_t calls, Operation &&operation)
+            {
+                if (!filter.empty() && name.find(filter) == std::string::npos)
+                {
+                    return;
+                }
+
+                using Clock = std::chrono::steady_clock;
+
+                size_t iterations = 1;
+                double best = 0.0;
+
+                for (;;)
+                {
+                    auto start = Clock::now();
+                    for (size_t i = 0; i < iterations; ++i)
+                    {
+                        operation();
+                    }
+                    auto elapsed = Clock::now() - start;
+
+                    if (elapsed >= minTime)
+                    {
+                        best = std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+                        break;
+                    }
+                    iterations *= 2;
+                }
+
+                for (int r = 1; r < repetitions; ++r)
+                {
+                    auto start = Clock::now();
+                    for (size_t i = 0; i < iterations; ++i)
+                    {
+                        operation();
+                    }
+                    double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / iterations;
+                    best = ns < best ? ns : best;
+                }
+
+                std::printf("%-56s %12zu %14.2f %12.3f\n", name.c_str(), calls, best, calls ? best / calls : best);
+            }
+
+        private:
+            std::string filter;
+            std::chrono::steady_clock::duration minTime = std::chrono::milliseconds(50);
+            int repetitions = 3;
+        };
+
+        /**
+         * @brief           Subscriber counts every fan-out benchmark is run with.
+         */
+        inline const std::vector<size_t> &SubscriberCounts()
+        {
+            static const std::vector<size_t> counts = {1, 8, 64, 1024, 65536};
+            return counts;
+        }
+    } // namespace bench
+} // namespace dw
@@ -0,0 +1,150 @@
+/**
+ * Reader scalability of ConcurrentDelegate against a Delegate guarded by a mutex, with and without a
+ * background thread continuously subscribing and unsubscribing.
+ *
+ * Build (from the repository root):
+ *     g++ -std=c++14 -O2 -I. bench/ConcurrentBenchmark.cpp -o concurrent_benchmark -pthread
+ *
+ * Usage:
+ *     ./concurrent_benchmark [--quick]
+ */
+
+#include "Benchmark.h"
+#include "../ConcurrentDelegate.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace dw;
+
+namespace
+{
+    constexpr size_t SubscriberCount = 16;
+
+    thread_local unsigned long long counter = 0;
+
+    void Handler(int value) { counter += value; }
+    void ChurnHandler(int value) { counter -= value; }
+
+    struct LockedDelegate
+    {
+        Delegate<int> del;
+        std::mutex mutex;
+
+        void operator()(int value)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            del(value);
+        }
+        void Add()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            del += ChurnHandler;
+        }
+        void Remove()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            del -= ChurnHandler;
+        }
+    };
+
+    struct LockFreeDelegate
+    {
+        ConcurrentDelegate<int> del;
+
+        void operator()(int value) { del(value); }
+        void Add() { del += ChurnHandler; }
+        void Remove() { del -= ChurnHandler; }
+    };
+
+    /**
+     * @returns         Invocations per second summed over all reader threads.
+     */
+    template <typename Target>
+    double Measure(Target &target, unsigned readers, bool churn, std::chrono::milliseconds duration)
+    {
+        std::atomic<bool> start(false), stop(false);
+        std::atomic<unsigned long long> invocations(0);
+        std::vector<std::thread> threads;
+
+        for (unsigned r = 0; r < readers; ++r)
+        {
+            threads.emplace_back([&] {
+                while (!start.load())
+                {
+                }
+                unsigned long long local = 0;
+                while (!stop.load(std::memory_order_relaxed))
+                {
+                    target(1);
+                    ++local;
+                }
+                invocations += local;
+                bench::DoNotOptimize(counter);
+            });
+        }
+        if (churn)
+        {
+            threads.emplace_back([&] {
+                while (!start.load())
+                {
+                }
+                while (!stop.load(std::memory_order_relaxed))
+                {
+                    target.Add();
+                    target.Remove();
+                }
+            });
+        }
+
+        start = true;
+        std::this_thread::sleep_for(duration);
+        stop = true;
+        for (auto &t : threads)
+        {
+            t.join();
+        }
+
+        return invocations.load() / std::chrono::duration<double>(duration).count();
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    auto duration = std::chrono::milliseconds(500);
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--quick") == 0)
+        {
+            duration = std::chrono::milliseconds(50);
+        }
+    }
+    unsigned maxReaders = std::thread::hardware_concurrency();
+    maxReaders = maxReaders ? maxReaders : 1;
+
+    LockedDelegate locked;
+    LockFreeDelegate lockFree;
+    for (size_t i = 0; i < SubscriberCount; ++i)
+    {
+        locked.del += Handler;
+        lockFree.del += Handler;
+    }
+
+    std::printf("%-40s %8s %8s %18s\n", "Benchmark", "Readers", "Churn", "invocations/s");
+    for (unsigned readers = 1; readers <= maxReaders; readers *= 2)
+    {
+        for (bool churn : {false, true})
+        {
+            std::printf("%-40s %8u %8s %18.0f\n", "std::mutex + Delegate<int>", readers, churn ? "yes" : "no",
+                        Measure(locked, readers, churn, duration));
+            std::printf("%-40s %8u %8s %18.0f\n", "ConcurrentDelegate<int>", readers, churn ? "yes" : "no",
+                        Measure(lockFree, readers, churn, duration));
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,484 @@
+/**
+ * Behaviour checks of the delegate classes: what their documentation promises, one function per class or feature.
+ *
+ * Build (from the repository root):
+ *     g++ -std=c++14 -O2 -I. bench/DelegateTest.cpp -o delegate_test -pthread
+ *
+ * Usage:
+ *     ./delegate_test
+ *
+ * Prints each failed check and returns 1 if any failed. Build with -fsanitize=address,undefined (or thread) to also
+ * catch memory, alignment and threading errors.
+ */
+
+#include "../Delegate.h"
+#include "../CommandBuffer.h"
+#include "../CompactDelegate.h"
+#include "../ConcurrentDelegate.h"
+#include "../DoubleBufferedDelegate.h"
+#include "../InlineDelegate.h"
+#include "../PriorityDelegate.h"
+#include "../QueuedDelegate.h"
+#include "../ThreadPool.h"
+#if __cplusplus >= 201703L
+#include "../StaticDelegate.h"
+#endif
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace dw;
+
+namespace
+{
+    int checks = 0;
+    int failures = 0;
+
+    void Check(bool condition, const char *expression, int line)
+    {
+        checks++;
+        if (!condition)
+        {
+            failures++;
+            std::printf("FAILED line %d: %s\n", line, expression);
+        }
+    }
+
+#define CHECK(condition) Check((condition), #condition, __LINE__)
+
+    /**
+     * Functor recording its tag into a shared log. Has no padding, so it compares equal (bytewise, see Callable::operator==)
+     * to any other Tag with the same log and tag.
+     */
+    struct Tag
+    {
+        std::string *log;
+        std::intptr_t tag;
+
+        void operator()(int) const { *log += static_cast<char>(tag); }
+    };
+
+    void TestHandles()
+    {
+        Delegate<int> del;
+        int calls = 0;
+        auto lambda = [&calls](int) { calls++; };
+
+        SubscriptionHandle first = del.Add(lambda);
+        SubscriptionHandle second = del.Add(lambda);
+        CHECK(del.Unsubscribe(first));
+        CHECK(!del.Unsubscribe(first));
+
+        del(1);
+        CHECK(calls == 1);
+        CHECK(!del.IsSubscribed(first));
+        CHECK(del.IsSubscribed(second));
+
+        // The slot of the first subscription is reused: its handle must still not match.
+        SubscriptionHandle third = del.Add(lambda);
+        CHECK(third.index == first.index);
+        CHECK(!del.IsSubscribed(first));
+        CHECK(!del.Unsubscribe(first));
+        CHECK(del.Count() == 2);
+    }
+
+    void TestConnections()
+    {
+        Delegate<int> del;
+        int calls = 0;
+        {
+            ScopedConnection connection = del.Connect([&calls](int) { calls++; });
+            del(1);
+            ScopedConnection moved = std::move(connection);
+            del(1);
+            CHECK(del.Count() == 1);
+        }
+        del(1);
+        CHECK(calls == 2);
+        CHECK(del.Count() == 0);
+
+        SubscriptionHandle kept;
+        {
+            ScopedConnection connection(del, del.Subscribe([&calls](int) { calls++; }, 0));
+            kept = connection.Release();
+        }
+        CHECK(del.IsSubscribed(kept));
+    }
+
+    void TestSavedCalls()
+    {
+        // A subscription has a single target, whether called by operator() or Invoke().
+        Delegate<int> del;
+        int total = 0;
+        del.Subscribe([&total, state = 0](int x) mutable { state += x; total = state; }, 10);
+        del(1);
+        del.Invoke();
+        del(1);
+        CHECK(total == 12);
+
+        Delegate<bool> flags;
+        int set = 0;
+        flags.Subscribe([&set](bool flag) { set += flag; }, true);
+        flags.Subscribe([&set](bool flag) { set += flag; }, false);
+        flags.Invoke();
+        CHECK(set == 1);
+
+        std::string log;
+        Delegate<int> grouped;
+        for (int i = 0; i < 3; i++)
+        {
+            grouped.Subscribe(Tag{&log, 'a'}, i);
+            grouped.Subscribe(Tag{&log, 'b'}, i);
+        }
+        grouped.InvokeGrouped();
+        CHECK(log == "aaabbb");
+        grouped.Subscribe(Tag{&log, 'a'}, 3);
+        log.clear();
+        grouped.InvokeGrouped();
+        CHECK(log == "aaaabbb");
+
+        Delegate<int, float> batches;
+        int packs = 0;
+        SubscriptionHandle batch = batches.SubscribeBatch([&packs](Span<const int> ids, Span<const float> values) {
+            packs += static_cast<int>(ids.size() + values.size());
+        });
+        batches.Append(batch, 1, 0.5f);
+        batches.Append(batch, 2, 1.5f);
+        batches.Invoke();
+        CHECK(packs == 4);
+    }
+
+    int uploaded = 0;
+
+    void Upload(std::unique_ptr<int> value) { uploaded += *value; }
+    int Scale(std::unique_ptr<int> value, int factor) { return *value * factor; }
+
+    void TestMoveOnly()
+    {
+        Delegate<std::unique_ptr<int>> uploads;
+        uploads.Subscribe(Upload, std::unique_ptr<int>(new int(3)));
+        uploads.Subscribe([](const std::unique_ptr<int> &value) { uploaded += 10 * *value; }, std::unique_ptr<int>(new int(4)));
+        uploads.InvokeAndClear();
+        CHECK(uploaded == 43);
+        CHECK(uploads.Count() == 0);
+
+        RetDelegate<int, std::unique_ptr<int>, int> scaled;
+        scaled.Subscribe(Scale, std::unique_ptr<int>(new int(6)), 7);
+        CHECK(scaled.InvokeAndClear() == 42);
+
+        DoubleBufferedDelegate<std::unique_ptr<int>> frames;
+        frames.Record(Upload, std::unique_ptr<int>(new int(100)));
+        CHECK(frames.Swap());
+        CHECK(frames.Execute() == 1);
+        CHECK(uploaded == 143);
+    }
+
+    void TestCombiners()
+    {
+        RetDelegate<int, int> del;
+        int calls = 0;
+        del += [&calls](int x) { calls++; return x; };
+        del += [&calls](int x) { calls++; return 3 * x; };
+        del += [&calls](int x) { calls++; return 2 * x; };
+
+        CHECK(del(1) == 6);
+        CHECK(del(MaxResult<int>(), 1) == 3);
+        CHECK(del(MinResult<int>(), 1) == 1);
+        CHECK(del(LastResult<int>(), 1) == 2);
+
+        calls = 0;
+        CHECK(del(FirstResult<int>(), 1) == 1);
+        CHECK(calls == 1);
+
+        calls = 0;
+        CHECK(del.CallUntil([](int result) { return result > 2; }, 1));
+        CHECK(calls == 2);
+
+        int results[2] = {};
+        CHECK(del(CollectResults<int>(Span<int>(results, 2)), 1) == 2);
+        CHECK(results[0] == 1 && results[1] == 3);
+
+        CHECK(del(Fold(0, [](int total, int result) { return total * 10 + result; }), 1) == 132);
+
+        RetDelegate<bool, int> filters;
+        filters += [](int x) { return x > 0; };
+        filters += [](int x) { return x > 10; };
+        CHECK(filters.AnyOf(5));
+        CHECK(!filters.AllOf(5));
+        CHECK(filters.AllOf(50));
+    }
+
+    void TestParallel()
+    {
+        ThreadPool pool(4);
+
+        RetDelegate<std::string> names;
+        std::string expected;
+        for (int i = 0; i < 200; i++)
+        {
+            char name = static_cast<char>('a' + i % 26);
+            names += [name] { return std::string(1, name); };
+            expected += name;
+        }
+        auto concatenate = [](std::string lhs, std::string rhs) { return lhs + rhs; };
+        for (int run = 0; run < 20; run++)
+        {
+            CHECK(names(Parallel(pool, 7), concatenate) == expected);
+            CHECK(names(DeterministicParallel(pool, 7), concatenate) == expected);
+        }
+
+        RetDelegate<int, int> values;
+        for (int i = 0; i < 1000; i++)
+        {
+            values += [](int x) { return x; };
+        }
+        CHECK(values(Parallel(pool), 2) == 2000);
+
+        Delegate<int> saved;
+        std::atomic<int> total{0};
+        for (int i = 0; i < 1000; i++)
+        {
+            saved.Subscribe([&total](int x) { total += x; }, i);
+        }
+        saved.InvokeParallel(pool, 16);
+        CHECK(total == 999 * 1000 / 2);
+    }
+
+    void TestAsync()
+    {
+        ThreadPool pool(4);
+
+        RetDelegate<bool, int> filters;
+        for (int i = 0; i < 64; i++)
+        {
+            filters += [i](int x) { return x == i; };
+        }
+        RetDelegate<bool, int>::Async filtered;
+        for (int run = 0; run < 20; run++)
+        {
+            filters.InvokeAsync(pool, filtered, 63);
+            filtered.Wait();
+            CHECK(filtered.Result());
+            filters.InvokeAsync(pool, filtered, 64);
+            filtered.Wait();
+            CHECK(!filtered.Result());
+        }
+
+        RetDelegate<std::string> names;
+        names += [] { return std::string("a"); };
+        names += [] { return std::string("b"); };
+        names += [] { return std::string("c"); };
+        RetDelegate<std::string>::Async named;
+        names.InvokeAsync(pool, named);
+        named.Wait();
+        CHECK(named.Result() == "abc");
+
+        Delegate<int> events;
+        std::atomic<int> total{0};
+        events += [&total](int x) { total += x; };
+        events += [&total](int x) { total += x; };
+        Delegate<int>::Async done;
+        bool continued = false;
+        events.InvokeAsync(pool, done, 5);
+        done.Then([&continued](Delegate<int>::Async &) { continued = true; });
+        done.Wait();
+        CHECK(total == 10);
+        CHECK(continued);
+        CHECK(done.IsDone());
+    }
+
+    void TestPriority()
+    {
+        std::string log;
+        PriorityDelegate<int> del;
+        del += Tag{&log, 'd'};
+        SubscriptionHandle first = del.Subscribe(Tag{&log, 'a'}, Priority{100});
+        del.Subscribe(Tag{&log, 'b'}, Priority{10});
+        del(0);
+        del.Subscribe(Tag{&log, 'c'}, Priority{10});
+        del.Subscribe(Tag{&log, 'e'}, Priority{-1});
+        log.clear();
+        del(0);
+        CHECK(log == "abcde");
+        CHECK(del.PriorityOf(first).value == 100);
+
+        CHECK(del.Unsubscribe(first));
+        CHECK(del.PriorityOf(first).value == 0);
+        del.Subscribe(Tag{&log, 'a'}, Priority{10});
+        log.clear();
+        del(0);
+        CHECK(log == "bcade");
+
+        del -= Tag{&log, 'c'};
+        log.clear();
+        del(0);
+        CHECK(log == "bade");
+    }
+
+    struct alignas(16) Aligned
+    {
+        float values[4];
+    };
+
+    void TestCommandBuffer()
+    {
+        CommandBuffer commands;
+        Delegate<int, float> moved;
+        int total = 0;
+        int misaligned = 0;
+        moved += [&total](int x, float y) { total += x + static_cast<int>(y); };
+
+        for (int i = 0; i < 20; i++)
+        {
+            commands.Record(moved, 1, 2.0f);
+            commands.RecordFunction([&total](char c, short s, int x) { total += c + s + x; }, char(1), short(1), 1);
+            commands.RecordFunction([&misaligned](const Aligned &aligned) {
+                misaligned += reinterpret_cast<uintptr_t>(&aligned) % alignof(Aligned) != 0;
+            }, Aligned());
+            commands.RecordFunction([&total](const std::string &text, int &counter) { counter += static_cast<int>(text.size()); },
+                                    std::string(40, 'x'), std::ref(total));
+        }
+        CHECK(commands.Count() == 80);
+        CHECK(commands.Replay() == 80);
+        CHECK(total == 20 * (3 + 3 + 40));
+        CHECK(misaligned == 0);
+
+        commands.Reset();
+        CHECK(commands.IsEmpty());
+        commands.Replay();
+        CHECK(total == 20 * (3 + 3 + 40));
+    }
+
+    void TestInline()
+    {
+        InlineDelegate<2, int> del;
+        int total = 0;
+        SubscriptionHandle counter = del.Subscribe([&total, state = 0](int x) mutable { state += x; total = state; }, 10);
+        del(1);
+        del.Invoke();
+        CHECK(total == 11);
+        del += [](int) {};
+        CHECK(del.Full());
+        CHECK(del.Unsubscribe(counter));
+        CHECK(del.Count() == 1);
+
+        BasicInlineDelegate<1, InlineOverflow::Reject, void> rejecting;
+        CHECK(rejecting.IsSubscribed(rejecting.Add([] {})));
+        CHECK(!rejecting.IsSubscribed(rejecting.Add([] {})));
+    }
+
+    void Increment(int &value) { value++; }
+
+    void TestCompact()
+    {
+        CHECK(sizeof(CompactDelegate<int &>) == sizeof(void *));
+
+        CompactDelegate<int &> del;
+        int value = 0;
+        CHECK(del.IsEmpty());
+        del += Increment;
+        CHECK(del.Count() == 1);
+        del += [](int &x) { x += 10; };
+        del(value);
+        CHECK(value == 11);
+        del -= Increment;
+        del(value);
+        CHECK(value == 21);
+        CHECK(del.Count() == 1);
+    }
+
+    struct Counter
+    {
+        int hits = 0;
+        void Hit(int amount) { hits += amount; }
+    };
+
+    void TestBound()
+    {
+        Counter first, second;
+        BoundDelegate<int> del;
+        del.Subscribe<Counter, &Counter::Hit>(&first);
+        del.Subscribe<Counter, &Counter::Hit>(&second);
+        del(2);
+        del.UnsubscribeAll(&first);
+        del(3);
+        CHECK(first.hits == 2);
+        CHECK(second.hits == 5);
+    }
+
+    void TestConcurrent()
+    {
+        ConcurrentDelegate<int> del;
+        std::atomic<int> total{0};
+        del += [&total](int x) { total += x; };
+        std::vector<std::thread> readers;
+        for (int i = 0; i < 4; i++)
+        {
+            readers.emplace_back([&del] {
+                for (int j = 0; j < 1000; j++)
+                {
+                    del(1);
+                }
+            });
+        }
+        for (auto &reader : readers)
+        {
+            reader.join();
+        }
+        CHECK(total == 4000);
+        CHECK(del.Count() == 1);
+    }
+
+    void TestQueued()
+    {
+        QueuedDelegate<int> queue(2, QueueFullPolicy::Drop);
+        std::vector<int> drained;
+        queue += [&drained](int x) { drained.push_back(x); };
+        CHECK(queue.Post(1));
+        CHECK(queue.Post(2));
+        CHECK(!queue.Post(3));
+        CHECK(queue.Dropped() == 1);
+        CHECK(queue.Drain() == 2);
+        CHECK((drained == std::vector<int>{1, 2}));
+    }
+
+#if __cplusplus >= 201703L
+    int Twice(int x) { return 2 * x; }
+    int Thrice(int x) { return 3 * x; }
+
+    void TestStatic()
+    {
+        StaticDelegate<&Twice, &Thrice> del;
+        CHECK(del(1) == 5);
+        CHECK(del(MaxResult<int>(), 1) == 3);
+        CHECK(del.Count() == 2);
+    }
+#endif
+} // namespace
+
+int main()
+{
+    TestHandles();
+    TestConnections();
+    TestSavedCalls();
+    TestMoveOnly();
+    TestCombiners();
+    TestParallel();
+    TestAsync();
+    TestPriority();
+    TestCommandBuffer();
+    TestInline();
+    TestCompact();
+    TestBound();
+    TestConcurrent();
+    TestQueued();
+#if __cplusplus >= 201703L
+    TestStatic();
+#endif
+
+    std::printf("%d checks, %d failed\n", checks, failures);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,138 @@
+/**
+ * Memory footprint of one million delegates with 0, 1 and 4 subscribers: Delegate (two vectors per object) against
+ * CompactDelegate (one pointer per object), and the cost of calling all of them.
+ *
+ * Heap bytes are the live bytes the subscriptions requested through a counting allocator, without malloc's own overhead.
+ *
+ * Build (from the repository root):
+ *     g++ -std=c++14 -O2 -I. bench/FootprintBenchmark.cpp -o footprint_benchmark
+ *
+ * Usage:
+ *     ./footprint_benchmark [--quick] [filter]
+ */
+
+#include "Benchmark.h"
+#include "../CompactDelegate.h"
+#include "../Delegate.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace dw;
+using bench::Runner;
+
+namespace
+{
+    constexpr size_t InstanceCount = 1000000;
+
+    size_t liveBytes = 0;
+
+    /**
+     * @brief           std::allocator keeping count of the live bytes it allocated.
+     */
+    template <typename T>
+    struct CountingAllocator : std::allocator<T>
+    {
+        using value_type = T;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = CountingAllocator<U>;
+        };
+
+        CountingAllocator() = default;
+        template <typename U>
+        CountingAllocator(const CountingAllocator<U> &) {}
+
+        T *allocate(size_t count)
+        {
+            liveBytes += count * sizeof(T);
+            return std::allocator<T>::allocate(count);
+        }
+
+        void deallocate(T *pointer, size_t count)
+        {
+            liveBytes -= count * sizeof(T);
+            std::allocator<T>::deallocate(pointer, count);
+        }
+    };
+
+    using CountedDelegate = BasicDelegate<CountingAllocator<char>, int>;
+    using CountedCompactDelegate = BasicCompactDelegate<CountingAllocator<char>, void, int>;
+
+    unsigned long long counter = 0;
+
+    void Handler(int value) { counter += value; }
+
+    struct Capturing
+    {
+        unsigned long long *target;
+        void operator()(int value) const { *target += value; }
+    };
+
+    /**
+     * @brief           Give each of *delegates* *subscribers* subscribers: plain functions, or one capturing functor.
+     */
+    template <typename DelegateType>
+    void Subscribe(std::vector<DelegateType> &delegates, size_t subscribers, bool capturing)
+    {
+        for (auto &del : delegates)
+        {
+            for (size_t i = 0; i < subscribers; ++i)
+            {
+                if (capturing)
+                {
+                    del += Capturing{&counter};
+                }
+                else
+                {
+                    del += Handler;
+                }
+            }
+        }
+    }
+
+    template <typename DelegateType>
+    void Measure(Runner &runner, const std::string &name, size_t subscribers, bool capturing)
+    {
+        std::vector<DelegateType> delegates(InstanceCount);
+        size_t before = liveBytes;
+        Subscribe(delegates, subscribers, capturing);
+        size_t heap = liveBytes - before;
+        size_t inline_ = sizeof(DelegateType) * InstanceCount;
+
+        std::printf("%-56s %12zu %9.1f MB object + %7.1f MB heap = %7.1f MB\n", name.c_str(), subscribers,
+                    inline_ / 1e6, heap / 1e6, (inline_ + heap) / 1e6);
+
+        runner.Run(name + " call all", subscribers * InstanceCount, [&] {
+            for (auto &del : delegates)
+            {
+                del(1);
+            }
+        });
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::printf("sizeof(Delegate<int>) = %zu, sizeof(CompactDelegate<int>) = %zu, %zu instances\n\n",
+                sizeof(Delegate<int>), sizeof(CompactDelegate<int>), InstanceCount);
+
+    Runner runner(argc, argv);
+
+    for (size_t subscribers : {0, 1, 4})
+    {
+        Measure<CountedDelegate>(runner, "Delegate, functions", subscribers, false);
+        Measure<CountedCompactDelegate>(runner, "CompactDelegate, functions", subscribers, false);
+        if (subscribers)
+        {
+            Measure<CountedDelegate>(runner, "Delegate, capturing functor", subscribers, true);
+            Measure<CountedCompactDelegate>(runner, "CompactDelegate, capturing functor", subscribers, true);
+        }
+    }
+
+    bench::DoNotOptimize(counter);
+    return 0;
+}
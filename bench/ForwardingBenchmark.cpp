@@ -0,0 +1,106 @@
+/**
+ * Invocation of 100 subscribers with a 1 KB argument taken by value in the delegate signature: the delegates bind it
+ * once and hand the same object to every subscriber, against calling each Callable with its own copy (what the
+ * delegates did before) and a std::vector<std::function<...>> loop. Prints the count of payload copies per invocation.
+ *
+ * Build (from the repository root):
+ *     g++ -std=c++14 -O2 -I. bench/ForwardingBenchmark.cpp -o forwarding_benchmark
+ *
+ * Usage:
+ *     ./forwarding_benchmark [--quick] [filter]
+ */
+
+#include "Benchmark.h"
+#include "../Delegate.h"
+
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace dw;
+using bench::Runner;
+
+namespace
+{
+    constexpr size_t SubscriberCount = 100;
+
+    size_t copies = 0;
+    unsigned long long counter = 0;
+
+    struct Payload
+    {
+        unsigned char bytes[1024] = {1};
+
+        Payload() = default;
+        Payload(const Payload &other)
+        {
+            copies++;
+            std::memcpy(bytes, other.bytes, sizeof(bytes));
+        }
+        Payload &operator=(const Payload &other)
+        {
+            copies++;
+            std::memcpy(bytes, other.bytes, sizeof(bytes));
+            return *this;
+        }
+    };
+
+    void ByReference(const Payload &payload) { counter += payload.bytes[0]; }
+    void ByValue(Payload payload) { counter += payload.bytes[0]; }
+    int Read(const Payload &payload) { return payload.bytes[0]; }
+
+    /**
+     * @brief           Run *operation* once to count the copies it makes, then measure it.
+     */
+    template <typename Operation>
+    void Measure(Runner &runner, const std::string &name, Operation &&operation)
+    {
+        copies = 0;
+        operation();
+        std::printf("%-56s %12zu copies per invocation\n", name.c_str(), copies);
+        runner.Run(name, SubscriberCount, operation);
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Runner runner(argc, argv);
+    Payload payload;
+
+    Delegate<Payload> del;
+    RetDelegate<int, Payload> ret;
+    SimpleDelegate<Payload> simple;
+    Delegate<Payload> byValue;
+    std::vector<Callable<void, Payload>> callables;
+    std::vector<std::function<void(Payload)>> functions;
+    for (size_t i = 0; i < SubscriberCount; ++i)
+    {
+        del += ByReference;
+        ret += Read;
+        simple += ByReference;
+        byValue += ByValue;
+        callables.push_back(ByReference);
+        functions.push_back(ByReference);
+    }
+
+    Measure(runner, "Delegate, const& subscribers", [&] { del(payload); });
+    Measure(runner, "RetDelegate, const& subscribers", [&] { counter += ret(payload); });
+    Measure(runner, "SimpleDelegate, const& subscribers", [&] { simple(payload); });
+    Measure(runner, "Delegate, by-value subscribers", [&] { byValue(payload); });
+    Measure(runner, "Callable loop, copy per call", [&] {
+        for (auto &function : callables)
+        {
+            function(payload);
+        }
+    });
+    Measure(runner, "std::function loop, copy per call", [&] {
+        for (auto &function : functions)
+        {
+            function(payload);
+        }
+    });
+
+    bench::DoNotOptimize(counter);
+    return 0;
+}
@@ -0,0 +1,91 @@
+/**
+ * Deferred invocation of a large list of interleaved saved calls of a few functions: Invoke() in saved order against
+ * InvokeGrouped(), which calls each function over a contiguous run.
+ *
+ * Build (from the repository root):
+ *     g++ -std=c++14 -O2 -I. bench/GroupedInvokeBenchmark.cpp -o grouped_invoke_benchmark
+ *
+ * Usage:
+ *     ./grouped_invoke_benchmark [--quick] [filter]
+ */
+
+#include "Benchmark.h"
+#include "../Delegate.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace dw;
+using bench::Runner;
+
+namespace
+{
+    constexpr size_t TargetCount = 8;
+
+    unsigned long long counter = 0;
+
+    template <int N>
+    void Handler(int value, float scale)
+    {
+        counter += static_cast<unsigned long long>(value * scale) * (N + 1) ^ N;
+    }
+
+    using HandlerType = void (*)(int, float);
+
+    const HandlerType Targets[TargetCount] = {
+        &Handler<0>, &Handler<1>, &Handler<2>, &Handler<3>, &Handler<4>, &Handler<5>, &Handler<6>, &Handler<7>};
+
+    /**
+     * @returns         Target of each saved call, picked at random.
+     */
+    std::vector<size_t> InterleavedTargets(size_t count)
+    {
+        std::mt19937 random(42);
+        std::vector<size_t> targets(count);
+        for (auto &target : targets)
+        {
+            target = random() % TargetCount;
+        }
+        return targets;
+    }
+
+    void Stage(Delegate<int, float> &del, const std::vector<size_t> &targets)
+    {
+        del.Clear();
+        for (size_t i = 0; i < targets.size(); ++i)
+        {
+            del.Subscribe(Targets[targets[i]], static_cast<int>(i), 0.5f);
+        }
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Runner runner(argc, argv);
+
+    for (size_t count : {size_t(1024), size_t(65536), size_t(262144)})
+    {
+        std::vector<size_t> targets = InterleavedTargets(count);
+        Delegate<int, float> del;
+
+        Stage(del, targets);
+        runner.Run("Delegate::Invoke (interleaved)", count, [&] { del.Invoke(); });
+
+        del.GroupSavedCalls();
+        runner.Run("Delegate::Invoke (grouped)", count, [&] { del.Invoke(); });
+        runner.Run("Delegate::InvokeGrouped (already grouped)", count, [&] { del.InvokeGrouped(); });
+
+        runner.Run("Stage + Delegate::Invoke", count, [&] {
+            Stage(del, targets);
+            del.Invoke();
+        });
+        runner.Run("Stage + Delegate::InvokeGrouped", count, [&] {
+            Stage(del, targets);
+            del.InvokeGrouped();
+        });
+    }
+
+    bench::DoNotOptimize(counter);
+    return 0;
+}
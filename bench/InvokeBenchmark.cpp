@@ -0,0 +1,235 @@
+/**
+ * Invocation throughput of every delegate class in Delegate.h.
+ *
+ * Build (from the repository root):
+ *     g++ -std=c++14 -O2 -I. bench/InvokeBenchmark.cpp -o invoke_benchmark
+ *
+ * Usage:
+ *     ./invoke_benchmark [--quick] [filter]
+ */
+
+#include "Benchmark.h"
+#include "../Delegate.h"
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace dw;
+using bench::Runner;
+
+namespace
+{
+    unsigned long long counter = 0;
+
+    struct LargeStruct
+    {
+        unsigned char bytes[256] = {};
+    };
+
+    template <typename... Params>
+    struct Handlers
+    {
+        static void Free(Params...) { ++counter; }
+        static int Ret(Params...) { return 1; }
+
+        struct Object
+        {
+            int hits = 0;
+            void Method(Params...) { ++hits; }
+            int RetMethod(Params...) { return ++hits; }
+        };
+    };
+
+    std::string Name(const char *type, const char *shape, const char *method)
+    {
+        return std::string(type) + "<" + shape + ">::" + method;
+    }
+
+    template <typename... Params>
+    void RunBaselines(Runner &runner, const char *shape, size_t count, Params... args)
+    {
+        using H = Handlers<Params...>;
+
+        std::vector<void (*)(Params...)> pointers(count, &H::Free);
+        runner.Run(Name("std::vector<void(*)>", shape, "loop"), count, [&] {
+            for (auto &&f : pointers)
+            {
+                f(args...);
+            }
+            bench::ClobberMemory();
+        });
+
+        std::vector<std::function<void(Params...)>> functions(count, &H::Free);
+        runner.Run(Name("std::vector<std::function>", shape, "loop"), count, [&] {
+            for (auto &&f : functions)
+            {
+                f(args...);
+            }
+            bench::ClobberMemory();
+        });
+    }
+
+    template <typename... Params>
+    void RunDelegates(Runner &runner, const char *shape, size_t count, Params... args)
+    {
+        using H = Handlers<Params...>;
+
+        SimpleDelegate<Params...> simple;
+        for (size_t i = 0; i < count; ++i)
+        {
+            simple += &H::Free;
+        }
+        runner.Run(Name("SimpleDelegate", shape, "operator()"), count, [&] {
+            simple(args...);
+            bench::ClobberMemory();
+        });
+
+        Delegate<Params...> del;
+        for (size_t i = 0; i < count; ++i)
+        {
+            del.Subscribe(&H::Free, args...);
+        }
+        runner.Run(Name("Delegate", shape, "operator()"), count, [&] {
+            del(args...);
+            bench::ClobberMemory();
+        });
+        runner.Run(Name("Delegate", shape, "Invoke()"), count, [&] {
+            del.Invoke();
+            bench::ClobberMemory();
+        });
+
+        RetDelegate<int, Params...> ret;
+        for (size_t i = 0; i < count; ++i)
+        {
+            ret.Subscribe(&H::Ret, args...);
+        }
+        runner.Run(Name("RetDelegate", shape, "operator()"), count, [&] {
+            bench::DoNotOptimize(ret(args...));
+        });
+        runner.Run(Name("RetDelegate", shape, "Invoke()"), count, [&] {
+            bench::DoNotOptimize(ret.Invoke());
+        });
+
+        typename H::Object object;
+
+        MemberDelegate<typename H::Object, Params...> member;
+        for (size_t i = 0; i < count; ++i)
+        {
+            member.Subscribe(&object, &H::Object::Method, args...);
+        }
+        runner.Run(Name("MemberDelegate", shape, "operator()"), count, [&] {
+            member(&object, args...);
+            bench::ClobberMemory();
+        });
+        runner.Run(Name("MemberDelegate", shape, "Invoke()"), count, [&] {
+            member.Invoke();
+            bench::ClobberMemory();
+        });
+
+        RetMemberDelegate<int, typename H::Object, Params...> retMember;
+        for (size_t i = 0; i < count; ++i)
+        {
+            retMember.Subscribe(&object, &H::Object::RetMethod, args...);
+        }
+        runner.Run(Name("RetMemberDelegate", shape, "operator()"), count, [&] {
+            bench::DoNotOptimize(retMember(&object, args...));
+        });
+        runner.Run(Name("RetMemberDelegate", shape, "Invoke()"), count, [&] {
+            bench::DoNotOptimize(retMember.Invoke());
+        });
+
+        std::vector<typename H::Object> objects(count);
+
+        BoundDelegate<Params...> bound;
+        for (auto &o : objects)
+        {
+            bound.template Subscribe<typename H::Object, &H::Object::Method>(&o);
+        }
+        runner.Run(Name("BoundDelegate", shape, "operator()"), count, [&] {
+            bound(args...);
+            bench::ClobberMemory();
+        });
+
+        RetBoundDelegate<int, Params...> retBound;
+        for (auto &o : objects)
+        {
+            retBound.template Subscribe<typename H::Object, &H::Object::RetMethod>(&o);
+        }
+        runner.Run(Name("RetBoundDelegate", shape, "operator()"), count, [&] {
+            bench::DoNotOptimize(retBound(args...));
+        });
+    }
+
+    /**
+     * Capturing handlers: Delegate stores them in Callable's inline buffer, std::function allocates
+     * for targets that are not trivially copyable (e.g. capturing a std::shared_ptr).
+     */
+    template <typename Handler>
+    void RunCapturing(Runner &runner, const char *capture, size_t count, const Handler &handler)
+    {
+        std::vector<std::function<void(int, int)>> functions;
+        runner.Run(std::string("std::vector<std::function>(") + capture + ")::push_back", count, [&] {
+            functions.clear();
+            functions.shrink_to_fit();
+            for (size_t i = 0; i < count; ++i)
+            {
+                functions.push_back(handler);
+            }
+        });
+        runner.Run(std::string("std::vector<std::function>(") + capture + ")::loop", count, [&] {
+            for (auto &&f : functions)
+            {
+                f(1, 2);
+            }
+            bench::ClobberMemory();
+        });
+
+        Delegate<int, int> del;
+        runner.Run(std::string("Delegate(") + capture + ")::operator+=", count, [&] {
+            del.Clear();
+            for (size_t i = 0; i < count; ++i)
+            {
+                del += handler;
+            }
+        });
+        runner.Run(std::string("Delegate(") + capture + ")::operator()", count, [&] {
+            del(1, 2);
+            bench::ClobberMemory();
+        });
+    }
+
+    template <typename... Params>
+    void RunShape(Runner &runner, const char *shape, Params... args)
+    {
+        for (size_t count : bench::SubscriberCounts())
+        {
+            RunBaselines<Params...>(runner, shape, count, args...);
+            RunDelegates<Params...>(runner, shape, count, args...);
+        }
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Runner runner(argc, argv);
+
+    RunShape<>(runner, "");
+    RunShape<int, int>(runner, "int, int", 1, 2);
+    RunShape<bool>(runner, "bool", true);
+    RunShape<LargeStruct>(runner, "LargeStruct", LargeStruct());
+    RunShape<std::string>(runner, "std::string", std::string("a string long enough to defeat SSO"));
+
+    unsigned long long total = 0;
+    auto shared = std::make_shared<unsigned long long>(0);
+    for (size_t count : bench::SubscriberCounts())
+    {
+        RunCapturing(runner, "pointer, int", count, [&total, step = 3](int a, int b) { total += a + b + step; });
+        RunCapturing(runner, "std::shared_ptr", count, [shared](int a, int b) { *shared += a + b; });
+    }
+    bench::DoNotOptimize(total);
+
+    bench::DoNotOptimize(counter);
+    return 0;
+}
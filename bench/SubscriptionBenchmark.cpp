@@ -0,0 +1,85 @@
+/**
+ * Cost of subscribing and unsubscribing: O(1) handle based Unsubscribe() against the scanning operator-=.
+ *
+ * Build (from the repository root):
+ *     g++ -std=c++14 -O2 -I. bench/SubscriptionBenchmark.cpp -o subscription_benchmark
+ *
+ * Usage:
+ *     ./subscription_benchmark [--quick] [filter]
+ */
+
+#include "Benchmark.h"
+#include "../Delegate.h"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace dw;
+using bench::Runner;
+
+namespace
+{
+    unsigned long long counter = 0;
+
+    struct Handler
+    {
+        unsigned long long id;
+        void operator()(int value) const { counter += id + value; }
+    };
+
+    std::vector<size_t> ShuffledOrder(size_t count)
+    {
+        std::vector<size_t> order(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            order[i] = i;
+        }
+        std::shuffle(order.begin(), order.end(), std::mt19937(42));
+        return order;
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    Runner runner(argc, argv);
+
+    for (size_t count : bench::SubscriberCounts())
+    {
+        std::vector<size_t> order = ShuffledOrder(count);
+        std::vector<SubscriptionHandle> handles(count);
+
+        Delegate<int> del;
+        runner.Run("Delegate::Add + Unsubscribe(handle)", count, [&] {
+            for (size_t i = 0; i < count; ++i)
+            {
+                handles[i] = del.Add(Handler{i});
+            }
+            for (size_t i : order)
+            {
+                del.Unsubscribe(handles[i]);
+            }
+        });
+
+        // The scanning path is quadratic, skip it where it would run for minutes.
+        if (count > 1024)
+        {
+            continue;
+        }
+
+        runner.Run("Delegate::operator+= + operator-=", count, [&] {
+            for (size_t i = 0; i < count; ++i)
+            {
+                del += Handler{i};
+            }
+            for (size_t i : order)
+            {
+                del -= Handler{i};
+            }
+        });
+    }
+
+    bench::DoNotOptimize(counter);
+    return 0;
+}